@@ -0,0 +1,179 @@
+///
+/// @file Common_Background.ino
+/// @brief Example of background layer for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Static elements drawn once and saved as background,
+/// only the dynamic elements are drawn again at each loop
+/// @n Requires BACKGROUND_MODE = USE_BACKGROUND_YES in hV_List_Options.h
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+#if (BACKGROUND_MODE != USE_BACKGROUND_YES)
+#error Required BACKGROUND_MODE USE_BACKGROUND_YES
+#endif // BACKGROUND_MODE
+
+// Set parameters
+#define NUMBER_LOOPS 6
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Draw the static elements and save them as background
+///
+void displayBackground()
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dy = y / 4;
+
+    myScreen.clear(myColours.white);
+    myScreen.setPenSolid(false);
+    myScreen.dRectangle(0, 0, x, y, myColours.black);
+    myScreen.dLine(0, dy, x, 1, myColours.black);
+
+    myScreen.selectFont(Font_Terminal8x12);
+    myScreen.gText(4, 4, "Temperature");
+    myScreen.gText(4, 2 * dy, "Minimum");
+    myScreen.gText(x / 2, 2 * dy, "Maximum");
+
+    if (myScreen.saveBackground(BACKGROUND_OR) == RESULT_SUCCESS)
+    {
+        mySerial.println(formatString("Background %i bytes", myScreen.getBackgroundSize()));
+    }
+}
+
+///
+/// @brief Draw the dynamic elements as overlay
+/// @param value fixed-point value, one decimal
+///
+void displayOverlay(int32_t value)
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dy = y / 4;
+
+    // White is transparent with BACKGROUND_OR
+    myScreen.clear(myColours.white);
+
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gNumber(4, dy + 8, value, 1, 8, ALIGN_RIGHT, "oC");
+    myScreen.gNumber(4, 3 * dy, value - 35, 1, 8, ALIGN_RIGHT, "oC");
+    myScreen.gNumber(x / 2, 3 * dy, value + 42, 1, 8, ALIGN_RIGHT, "oC");
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Background");
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    displayBackground();
+
+    for (uint8_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        uint32_t chrono = micros();
+        displayOverlay(215 + index * 7);
+        chrono = micros() - chrono;
+
+        myScreen.flush();
+        mySerial.println(formatString("Overlay drawn in %i us", chrono));
+        wait(4);
+    }
+
+    myScreen.clearBackground();
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
@@ -0,0 +1,187 @@
+///
+/// @file Common_Binding.ino
+/// @brief Example of values bound to widgets for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Values bound to widgets with a deadband,
+/// changes batched into one refresh within the minimum interval
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Widgets
+#include "hV_Widget.h"
+#include "hV_Binding.h"
+
+// Set parameters
+#define NUMBER_STEPS 64
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+// Widgets, static tree
+hV_WidgetPanel rootPanel(&myScreen);
+hV_WidgetLabel titleLabel(&myScreen);
+hV_WidgetValue temperatureValue(&myScreen);
+hV_WidgetBar humidityBar(&myScreen);
+
+// Bindings
+hV_Binding bindingTemperature;
+hV_Binding bindingHumidity;
+hV_BindingGroup myBindings(&myScreen, &rootPanel);
+
+// Simulated measures
+uint16_t step = 0;
+
+// Prototypes
+
+// Utilities
+
+// Functions
+///
+/// @brief Simulated humidity, used as source
+/// @return humidity, %
+///
+int32_t readHumidity()
+{
+    return 40 + (step / 8) + ((step * 37) % 5);
+}
+
+///
+/// @brief Build the tree of widgets and the bindings
+///
+void buildWidgets()
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dy = y / 3;
+
+    rootPanel.setArea(0, 0, x, y);
+    rootPanel.setFrame(true);
+
+    titleLabel.setArea(2, 2, x - 4, dy - 2);
+    titleLabel.setFont(Font_Terminal8x12, ALIGN_CENTER);
+    titleLabel.setText("Living room");
+    rootPanel.addChild(&titleLabel);
+
+    temperatureValue.setFormat(Font_Terminal12x16, 7, 1, "oC");
+    temperatureValue.setArea(8, dy, 0, 0);
+    rootPanel.addChild(&temperatureValue);
+
+    humidityBar.setArea(8, 2 * dy, x - 16, dy - 4);
+    humidityBar.setRange(0, 100);
+    rootPanel.addChild(&humidityBar);
+
+    // Temperature set by the application, 0.3 °C deadband
+    bindingTemperature.setWidget(&temperatureValue);
+    bindingTemperature.setDeadband(3);
+    myBindings.addBinding(&bindingTemperature);
+
+    // Humidity read from the source, 3 % deadband
+    bindingHumidity.setWidget(&humidityBar);
+    bindingHumidity.setSource(readHumidity);
+    bindingHumidity.setDeadband(3);
+    myBindings.addBinding(&bindingHumidity);
+
+    // At most one refresh every 2 s, all values displayed at least every 20 s
+    myBindings.setInterval(2000, 20000);
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Binding");
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    myScreen.clear();
+    buildWidgets();
+
+    for (step = 0; step < NUMBER_STEPS; step += 1)
+    {
+        // Eg. from a Matter attribute callback
+        bindingTemperature.setValue(215 + (step / 4) + ((step * 37) % 3));
+
+        if (myBindings.service())
+        {
+            mySerial.println(formatString("Step %2i, refresh %i oC %i %%", step, bindingTemperature.getDisplayed(), bindingHumidity.getDisplayed()));
+        }
+        delay(500);
+    }
+
+    bindingStatistics_s statistics = myBindings.getStatistics();
+    mySerial.println(formatString("Values %i, changes %i, refreshes %i, batched %i", statistics.values, statistics.changes, statistics.refreshes, statistics.batched));
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
@@ -0,0 +1,206 @@
+///
+/// @file Common_Chart.ino
+/// @brief Example of time series and chart for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Simulated temperature added to a time series, drawn by two charts,
+/// samples with minimum and maximum per column and rollups with largest triangle three buckets.
+/// Only the new columns are drawn, the previous ones are scrolled left.
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Widgets
+#include "hV_Widget.h"
+
+// Set parameters
+#define NUMBER_SAMPLES 256
+#define SAMPLES_PER_FLUSH 16
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+// Temperature, x10
+hV_TimeSeries temperatures;
+
+// Widgets, static tree
+hV_WidgetPanel rootPanel(&myScreen);
+hV_WidgetLabel titleLabel(&myScreen);
+hV_WidgetChart samplesChart(&myScreen);
+hV_WidgetChart rollupChart(&myScreen);
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Build the tree of widgets
+///
+void buildWidgets()
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dy = (y - 20) / 2;
+
+    rootPanel.setArea(0, 0, x, y);
+
+    titleLabel.setArea(0, 0, x, 16);
+    titleLabel.setFont(Font_Terminal8x12, ALIGN_CENTER);
+    titleLabel.setText("Temperature -10..40 oC");
+    rootPanel.addChild(&titleLabel);
+
+    // Samples, narrower than the series, minimum and maximum per column
+    samplesChart.setArea(0, 20, x / 2, dy - 4);
+    samplesChart.setSeries(&temperatures, 0);
+    samplesChart.setRange(-100, 400);
+    samplesChart.setMode(CHART_MINMAX);
+    rootPanel.addChild(&samplesChart);
+
+    // Rollups of TIME_SERIES_FACTOR samples
+    rollupChart.setArea(0, 20 + dy, x, dy - 4);
+    rollupChart.setSeries(&temperatures, 1);
+    rollupChart.setRange(-100, 400);
+    rollupChart.setMode(CHART_LTTB);
+    rootPanel.addChild(&rollupChart);
+}
+
+///
+/// @brief Simulated temperature
+/// @param index sample
+/// @return temperature, x10
+///
+int16_t measure(uint16_t index)
+{
+    // Sine of 72 samples per period and noise
+    int32_t value = 150 + sin32x100((int32_t)index * 500) * 15 / 10 + (int32_t)((index * 37) % 61) - 30;
+    return value;
+}
+
+///
+/// @brief Render the widgets and refresh the screen if needed
+///
+void displayWidgets()
+{
+    uint32_t chrono = micros();
+    samplesChart.update();
+    rollupChart.update();
+    area_s area = rootPanel.render();
+    chrono = micros() - chrono;
+
+    if ((area.dx > 0) and (area.dy > 0))
+    {
+        myScreen.flush();
+    }
+
+    timeSample_s summary = temperatures.getSummary(0);
+    mySerial.println(formatString("Render %i us, samples %i, min %i max %i mean %i", chrono, temperatures.getTotal(), summary.minimum, summary.maximum, summary.mean));
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Chart");
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    myScreen.clear();
+    buildWidgets();
+
+    for (uint16_t index = 0; index < NUMBER_SAMPLES; index += 1)
+    {
+        temperatures.add(measure(index));
+
+        if ((index % SAMPLES_PER_FLUSH) == SAMPLES_PER_FLUSH - 1)
+        {
+            displayWidgets();
+            wait(2);
+        }
+    }
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
@@ -0,0 +1,191 @@
+///
+/// @file Common_Console.ino
+/// @brief Example of scrolling console for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Log view with print(), VT100 control sequences and scroll
+/// @n Benchmark of a scroll against a full redraw
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+#include "hV_Console.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define NUMBER_LINES 24
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+hV_Console myConsole(&myScreen);
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Log screen
+/// @note Title on the first line, console below
+///
+void displayLog()
+{
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    myScreen.selectFont(Font_Terminal8x12);
+    uint16_t dy = myScreen.characterSizeY();
+    myScreen.gText(0, 0, "Log");
+
+    myConsole.setArea(dy, myScreen.screenSizeY() - dy, Font_Terminal6x8);
+    mySerial.println(formatString("Console %i x %i", myConsole.getColumns(), myConsole.getRows()));
+
+    uint32_t chrono = micros();
+    for (uint8_t index = 0; index < NUMBER_LINES; index += 1)
+    {
+        myConsole.print("\x1b[7m");
+        myConsole.print(formatString("%02i", index));
+        myConsole.print("\x1b[0m Sensor ");
+        myConsole.print(index % 4);
+        myConsole.print(" = ");
+        myConsole.println(index * 7 % 100);
+    }
+    myConsole.print("\x1b[1;20HTop right\x1b[K");
+    uint32_t durationConsole = micros() - chrono;
+
+    myScreen.flush();
+
+    mySerial.println(formatString("%i lines, %i scrolls, %i us", NUMBER_LINES, myConsole.getScrollNumber(), durationConsole));
+}
+
+///
+/// @brief Benchmark screen
+/// @note Scroll by one line against a redraw of all the lines, flush excluded
+///
+void displayBenchmark()
+{
+    uint8_t rows = myConsole.getRows();
+    uint32_t chrono;
+    uint32_t durationScroll, durationRedraw;
+
+    // Scroll by one line and print the new line
+    chrono = micros();
+    myConsole.println("New line");
+    durationScroll = micros() - chrono;
+
+    // Redraw all the lines
+    chrono = micros();
+    myConsole.print("\x1b[2J");
+    for (uint8_t index = 0; index < rows; index += 1)
+    {
+        myConsole.print("\x1b[");
+        myConsole.print(index + 1);
+        myConsole.print("H New line");
+    }
+    durationRedraw = micros() - chrono;
+
+    myConsole.clear();
+    myConsole.println(formatString("Scroll %i us", durationScroll));
+    myConsole.println(formatString("Redraw %i us", durationRedraw));
+    myScreen.flush();
+
+    mySerial.println(formatString("scroll = %i us, redraw = %i us", durationScroll, durationRedraw));
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Log");
+    myScreen.clear();
+    displayLog();
+    wait(8);
+
+    mySerial.println("Benchmark");
+    displayBenchmark();
+    wait(8);
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
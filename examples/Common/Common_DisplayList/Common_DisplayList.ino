@@ -0,0 +1,187 @@
+///
+/// @file Common_DisplayList.ino
+/// @brief Example of display list for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n The whole screen is drawn again at each loop, only the area changed is rasterised,
+/// then the same list is rasterised again with another orientation
+/// @n Requires DISPLAY_LIST = USE_DISPLAY_LIST_YES in hV_List_Options.h
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+#if (DISPLAY_LIST != USE_DISPLAY_LIST_YES)
+#error Required DISPLAY_LIST USE_DISPLAY_LIST_YES
+#endif // DISPLAY_LIST
+
+// Set parameters
+#define NUMBER_LOOPS 6
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Draw the whole screen, as without display list
+/// @param value fixed-point value, one decimal
+///
+void displayScreen(int32_t value)
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dy = y / 4;
+
+    // Covered by the next rectangle, dropped
+    myScreen.clear();
+    myScreen.setPenSolid(true);
+    myScreen.dRectangle(0, 0, x, y, myColours.white);
+    myScreen.setPenSolid(false);
+    myScreen.dRectangle(0, 0, x, y, myColours.black);
+
+    myScreen.selectFont(Font_Terminal8x12);
+    myScreen.gText(4, 4, "Display list");
+
+    // Characters merged into one text
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gNumber(4, dy, value, 1, 8, ALIGN_RIGHT, "oC");
+
+    // Points merged into one span
+    for (uint16_t i = 0; i < x - 8; i += 1)
+    {
+        myScreen.point(4 + i, 2 * dy, myColours.black);
+    }
+
+    myScreen.setPenSolid(true);
+    myScreen.dRectangle(4, 3 * dy, (value % 100) + 1, dy / 2, myColours.black);
+}
+
+///
+/// @brief Display the statistics of the display list
+///
+void displayStatistics()
+{
+    displayListStatistics_s statistics = myScreen.getDisplayListStatistics();
+
+    mySerial.println(formatString("recorded %i, merged %i, dropped %i, skipped %i, drawn %i, area %i %i %i %i",
+                                  statistics.recorded, statistics.merged, statistics.dropped, statistics.skipped, statistics.drawn,
+                                  statistics.area.x0, statistics.area.y0, statistics.area.dx, statistics.area.dy));
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Display list");
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    myScreen.setDisplayList(true);
+
+    for (uint8_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        myScreen.resetDisplayListStatistics();
+        displayScreen(215 + index * 7);
+        myScreen.flush();
+        displayStatistics();
+        wait(4);
+    }
+
+    // Same list, other orientation, nothing drawn again
+    mySerial.println("Orientation");
+    myScreen.setOrientation((myScreen.getOrientation() + 2) % 4);
+    myScreen.resetDisplayListStatistics();
+    myScreen.flush();
+    displayStatistics();
+    wait(4);
+
+    myScreen.setDisplayList(false);
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
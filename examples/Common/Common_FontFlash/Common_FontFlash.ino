@@ -0,0 +1,189 @@
+///
+/// @file Common_FontFlash.ino
+/// @brief Example of fonts on external SPI Flash for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Benchmark of the glyph cache over typical dashboard strings
+/// @n Requires FONT_FLASH = USE_FONT_FLASH_YES in hV_List_Options.h
+/// and a font generated by extras/bdf2pdls.py with --binary written at FONT_ADDRESS
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+#if (FONT_FLASH != USE_FONT_FLASH_YES)
+#error Required FONT_FLASH USE_FONT_FLASH_YES
+#endif // FONT_FLASH
+
+// Set parameters
+#define NUMBER_LOOPS 8
+#define FONT_ADDRESS 0x000000 ///< Address of the font on SPI Flash
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+uint8_t fontFlash;
+
+// Typical dashboard strings
+const char * dashboard[] =
+{
+    "21.5°C", "-3.0°C", "45%", "1013 hPa", "12:34", "3.7 V", "100%", "22.0°C"
+};
+const uint8_t dashboardNumber = sizeof(dashboard) / sizeof(dashboard[0]);
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Benchmark screen
+/// @note Strings drawn into the frame-buffer, flush excluded
+///
+void displayBenchmark()
+{
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+
+    uint32_t chrono;
+    uint32_t duration;
+
+    myScreen.selectFont(fontFlash);
+    myScreen.resetFontCacheStatistics();
+
+    chrono = micros();
+    for (uint16_t loop = 0; loop < NUMBER_LOOPS; loop += 1)
+    {
+        for (uint8_t index = 0; index < dashboardNumber; index += 1)
+        {
+            myScreen.gText(0, 0, dashboard[index]);
+        }
+    }
+    duration = micros() - chrono;
+
+    fontCacheStatistics_s statistics = myScreen.getFontCacheStatistics();
+    uint32_t glyphs = statistics.hits + statistics.misses;
+    uint32_t rate = (glyphs > 0) ? (100 * statistics.hits / glyphs) : 0;
+
+    myScreen.clear();
+
+    myScreen.selectFont(fontFlash);
+    myScreen.gText(0, 0, dashboard[0]);
+    myScreen.gText(x / 2, 0, dashboard[3]);
+
+    myScreen.selectFont(Font_Terminal8x12);
+    uint16_t dy = myScreen.characterSizeY();
+    uint16_t y0 = y - 4 * dy;
+    myScreen.gTextf(0, y0 + 0 * dy, "Glyphs %u, hits %u%%", glyphs, rate);
+    myScreen.gTextf(0, y0 + 1 * dy, "SPI reads %u, bytes %u", statistics.reads, statistics.bytes);
+    myScreen.gTextf(0, y0 + 2 * dy, "Per string %u us", duration / (NUMBER_LOOPS * dashboardNumber));
+
+    myScreen.flush();
+
+    mySerial.println(formatString("glyphs = %i, hits = %i, misses = %i, reads = %i, bytes = %i", glyphs, statistics.hits, statistics.misses, statistics.reads, statistics.bytes));
+    mySerial.println(formatString("hit rate = %i %%, %i us per string", rate, duration / (NUMBER_LOOPS * dashboardNumber)));
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    fontFlash = myScreen.addFontFlash(FONT_ADDRESS);
+    if (fontFlash == 0)
+    {
+        mySerial.println("Font on SPI Flash not found");
+        while (0x01);
+    }
+
+    // Example
+    mySerial.println("Benchmark");
+    myScreen.clear();
+    displayBenchmark();
+    wait(8);
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
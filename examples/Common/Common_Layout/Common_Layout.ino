@@ -0,0 +1,210 @@
+///
+/// @file Common_Layout.ino
+/// @brief Example of text layout for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Multi-line messages with word wrap and alignment
+/// @n Benchmark of a layout computed again against a layout kept
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+#include "hV_Layout.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define NUMBER_LOOPS 16
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+hV_Layout myLayout(&myScreen);
+
+const char * message = "Battery low\nPlease charge the device within the next two days, otherwise the readings stop.";
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Alignments screen
+///
+void displayAlignments()
+{
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dx = x / 3;
+
+    myScreen.selectFont(Font_Terminal6x8);
+
+    const uint8_t alignment[3][2] =
+    {
+        { ALIGN_LEFT, ALIGN_TOP },
+        { ALIGN_CENTER, ALIGN_MIDDLE },
+        { ALIGN_RIGHT, ALIGN_BOTTOM }
+    };
+
+    for (uint8_t index = 0; index < 3; index += 1)
+    {
+        myLayout.setBox(index * dx + 2, 2, dx - 4, y - 4);
+        myLayout.setAlignment(alignment[index][0], alignment[index][1]);
+        myLayout.setText(message);
+        myLayout.draw();
+        myScreen.dRectangle(index * dx + 1, 1, dx - 2, y - 2, myColours.black);
+    }
+
+    myScreen.flush();
+}
+
+///
+/// @brief Benchmark screen
+/// @note Layout computed again against layout kept, flush excluded
+///
+void displayBenchmark()
+{
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+
+    uint32_t chrono;
+    uint32_t durationCompute, durationKeep;
+
+    myScreen.selectFont(Font_Terminal8x12);
+    myLayout.setBox(0, 0, x, y / 2);
+    myLayout.setAlignment(ALIGN_CENTER, ALIGN_MIDDLE);
+    myLayout.setText(message);
+
+    // Layout computed again
+    chrono = micros();
+    for (uint16_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        myLayout.invalidate();
+        myLayout.update();
+    }
+    durationCompute = micros() - chrono;
+
+    // Layout kept
+    chrono = micros();
+    for (uint16_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        myLayout.setText(message);
+        myLayout.update();
+    }
+    durationKeep = micros() - chrono;
+
+    myScreen.clear();
+    myLayout.draw();
+
+    if (myLayout.getOverflow() > 0)
+    {
+        mySerial.println(formatString("Overflow of %i bytes", myLayout.getOverflow()));
+    }
+
+    myScreen.gTextf(0, y - 2 * myScreen.characterSizeY(), "Layout %u us", durationCompute / NUMBER_LOOPS);
+    myScreen.gTextf(0, y - myScreen.characterSizeY(), "Kept %u us", durationKeep / NUMBER_LOOPS);
+    myScreen.flush();
+
+    mySerial.println(formatString("layout = %i us, kept = %i us, %i lines", durationCompute / NUMBER_LOOPS, durationKeep / NUMBER_LOOPS, myLayout.getLines()));
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Alignments");
+    myScreen.clear();
+    displayAlignments();
+    wait(8);
+
+    mySerial.println("Benchmark");
+    myScreen.clear();
+    displayBenchmark();
+    wait(8);
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
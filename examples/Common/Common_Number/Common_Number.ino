@@ -0,0 +1,171 @@
+///
+/// @file Common_Number.ino
+/// @brief Example of fixed-point numbers for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Benchmark of gNumber() against formatString() and gText()
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Set parameters
+#define NUMBER_LOOPS 64
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Benchmark screen
+/// @note Both routes draw the same values into the frame-buffer, flush excluded
+///
+void displayBenchmark()
+{
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dy = y / 6;
+
+    uint32_t chrono;
+    uint32_t durationString, durationNumber;
+    float value;
+
+    myScreen.selectFont(Font_Terminal16x24);
+
+    // Route 1: float, formatString() and gTextLarge()
+    chrono = micros();
+    for (uint16_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        value = -12.3 + index * 0.7;
+        myScreen.gTextLarge(0, 0, formatString("%5.1f", value));
+    }
+    durationString = micros() - chrono;
+
+    // Route 2: fixed-point and gNumberLarge()
+    chrono = micros();
+    for (uint16_t index = 0; index < NUMBER_LOOPS; index += 1)
+    {
+        int32_t valueX10 = -123 + index * 7;
+        myScreen.gNumberLarge(0, 0, valueX10, 1, 5);
+    }
+    durationNumber = micros() - chrono;
+
+    myScreen.clear();
+
+    myScreen.selectFont(Font_Terminal8x12);
+    myScreen.gText(0, 0 * dy, "Benchmark, 64 numbers");
+    myScreen.gText(0, 1 * dy, "formatString");
+    myScreen.gNumber(x / 2, 1 * dy, durationString / NUMBER_LOOPS, 0, 8, ALIGN_RIGHT, " us");
+    myScreen.gText(0, 2 * dy, "gNumber");
+    myScreen.gNumber(x / 2, 2 * dy, durationNumber / NUMBER_LOOPS, 0, 8, ALIGN_RIGHT, " us");
+
+    myScreen.selectFont(Font_Terminal12x16);
+    myScreen.gNumber(0, 3 * dy, -215, 1, 8, ALIGN_LEFT, "oC");
+    myScreen.gNumber(0, 4 * dy, 4250, 2, 8, ALIGN_CENTER, "%");
+    myScreen.gNumber(0, 5 * dy, 5, 2, 8, ALIGN_RIGHT, "V");
+
+    myScreen.flush();
+
+    mySerial.println(formatString("formatString = %i us, gNumber = %i us, per number", durationString / NUMBER_LOOPS, durationNumber / NUMBER_LOOPS));
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Benchmark");
+    myScreen.clear();
+    displayBenchmark();
+    wait(8);
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
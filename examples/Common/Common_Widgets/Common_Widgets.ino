@@ -0,0 +1,201 @@
+///
+/// @file Common_Widgets.ino
+/// @brief Example of retained widgets for basic edition
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Static tree of widgets, only the widgets changed are drawn again
+/// and the screen is refreshed only if an area was modified
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+///
+/// * Evaluation edition: for professionals or organisations, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// @see ReadMe.md for references
+/// @n
+///
+/// Release 830: First release
+///
+
+// Screen
+#include "PDLS_EXT4_Basic_Matter.h"
+
+#if (PDLS_EXT4_BASIC_MATTER_RELEASE < 812)
+#error Required PDLS_EXT4_BASIC_MATTER_RELEASE 812
+#endif // PDLS_EXT4_BASIC_MATTER_RELEASE
+
+// SDK
+// #include <Arduino.h>
+#include "hV_HAL_Peripherals.h"
+
+// Include application, user and local libraries
+// #include <SPI.h>
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Widgets
+#include "hV_Widget.h"
+
+// Set parameters
+#define NUMBER_STEPS 8
+
+// Define structures and classes
+
+// Define variables and constants
+// PDLS
+Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
+// Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardSiLabsBG24Explorer);
+
+// Widgets, static tree
+hV_WidgetPanel rootPanel(&myScreen);
+hV_WidgetLabel titleLabel(&myScreen);
+hV_WidgetValue temperatureValue(&myScreen);
+hV_WidgetBar humidityBar(&myScreen);
+hV_WidgetIcon dropIcon(&myScreen);
+hV_WidgetMenu modeMenu(&myScreen);
+
+// Icon 8x8, one byte per row, MSB first
+const uint8_t iconDrop[8] =
+{
+    0x18, 0x18, 0x3c, 0x7e, 0x7e, 0xff, 0x7e, 0x3c
+};
+
+const char * const optionsMode[3] = { "Auto", "Eco", "Off" };
+
+// Prototypes
+
+// Utilities
+///
+/// @brief Wait with countdown
+/// @param second duration, s
+///
+void wait(uint8_t second)
+{
+    for (uint8_t i = second; i > 0; i--)
+    {
+        mySerial.print(formatString(" > %i  \r", i));
+        delay(1000);
+    }
+    mySerial.print("         \r");
+}
+
+// Functions
+///
+/// @brief Build the tree of widgets
+///
+void buildWidgets()
+{
+    uint16_t x = myScreen.screenSizeX();
+    uint16_t y = myScreen.screenSizeY();
+    uint16_t dy = y / 4;
+
+    rootPanel.setArea(0, 0, x, y);
+    rootPanel.setFrame(true);
+
+    titleLabel.setArea(2, 2, x - 4, dy - 2);
+    titleLabel.setFont(Font_Terminal8x12, ALIGN_CENTER);
+    titleLabel.setText("Living room");
+    rootPanel.addChild(&titleLabel);
+
+    temperatureValue.setFormat(Font_Terminal12x16, 7, 1, "oC");
+    temperatureValue.setArea(8, dy, 0, 0);
+    rootPanel.addChild(&temperatureValue);
+
+    dropIcon.setArea(4, 2 * dy, 16, dy - 4);
+    dropIcon.setBitmap(iconDrop, 8, 8);
+    rootPanel.addChild(&dropIcon);
+
+    humidityBar.setArea(24, 2 * dy, x - 32, dy - 4);
+    humidityBar.setRange(0, 100);
+    rootPanel.addChild(&humidityBar);
+
+    modeMenu.setArea(4, 3 * dy, x - 8, dy - 4);
+    modeMenu.setFont(Font_Terminal8x12);
+    modeMenu.setOptions(optionsMode, 3);
+    modeMenu.setSelected(0);
+    rootPanel.addChild(&modeMenu);
+}
+
+///
+/// @brief Render the widgets and refresh the screen if needed
+///
+void displayWidgets()
+{
+    uint32_t chrono = millis();
+    area_s area = rootPanel.render();
+    chrono = millis() - chrono;
+
+    if ((area.dx > 0) and (area.dy > 0))
+    {
+        myScreen.flush();
+    }
+    mySerial.println(formatString("Render %i ms, area modified = %i %i %i %i", chrono, area.x0, area.y0, area.dx, area.dy));
+}
+
+// Add setup code
+///
+/// @brief Setup
+///
+void setup()
+{
+    // mySerial = Serial by default, otherwise edit hV_HAL_Peripherals.h
+    mySerial.begin(115200);
+    delay(500);
+    mySerial.println();
+    mySerial.println("=== " __FILE__);
+    mySerial.println("=== " __DATE__ " " __TIME__);
+    mySerial.println();
+
+    // Start
+    mySerial.println("begin");
+    myScreen.begin();
+    mySerial.println(formatString("%s %ix%i", myScreen.WhoAmI().c_str(), myScreen.screenSizeX(), myScreen.screenSizeY()));
+
+    // Example
+    mySerial.println("Widgets");
+    myScreen.setOrientation(ORIENTATION_LANDSCAPE);
+    myScreen.clear();
+    buildWidgets();
+
+    for (uint8_t step = 0; step < NUMBER_STEPS; step += 1)
+    {
+        temperatureValue.setValue(215 + (step / 2) * 3); // same value twice
+        humidityBar.setValue(40 + step * 5);
+        modeMenu.setSelected(step % 3);
+        displayWidgets();
+        wait(4);
+    }
+
+    // Nothing changed, no refresh
+    displayWidgets();
+
+    mySerial.println("Regenerate");
+    myScreen.regenerate();
+
+    mySerial.println("=== ");
+    mySerial.println();
+}
+
+// Add loop code
+///
+/// @brief Loop, empty
+///
+void loop()
+{
+    delay(1000);
+}
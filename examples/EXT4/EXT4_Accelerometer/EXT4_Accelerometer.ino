@@ -175,7 +175,19 @@ void loop()
         }
         mySerial.print(formatString(", o %i -> %i", oldOrientation, orientation));
 
-        if (orientation != oldOrientation) // Update display
+        if ((orientation + 2) % 4 == oldOrientation) // Rotate display, 180°
+        {
+            myScreen.rotate(orientation);
+            myScreen.selectFont(Font_Terminal12x16);
+            uint16_t dt = myScreen.characterSizeY();
+            myScreen.selectFont(Font_Terminal16x24);
+            myScreen.gText(0, dt, formatString("%i", orientation));
+            myScreen.gText(1, dt, formatString("%i", orientation));
+
+            myScreen.flush();
+            mySerial.print(" @");
+        }
+        else if (orientation != oldOrientation) // Update display
         {
             myScreen.clear();
             myScreen.setOrientation(orientation);
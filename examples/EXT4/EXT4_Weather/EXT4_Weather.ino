@@ -73,8 +73,6 @@ measure_s temperature;
 measure_s humidity;
 
 static uint32_t chrono32 = 0;
-static uint8_t countFlush = 1; // Counter for global update
-const uint8_t FAST_BEFORE_GLOBAL = 8; // Number of fast updates before golbal update
 bool flagDisplay = true;
 
 // Prototypes
@@ -106,21 +104,20 @@ bool displayValue(uint8_t slot, String name, measure_s * value, String unit)
     myScreen.selectFont(Font_Terminal12x16);
     myScreen.gText(x0, y0, name);
 
+    // Fixed-point x10, no floating-point formatting, no String
     myScreen.selectFont(Font_Terminal16x24);
-    myScreen.gTextLarge(x0, y0 + 1 * dy, formatString("%5.1f", (*value).value));
+    myScreen.gNumberLarge(x0, y0 + 1 * dy, (int32_t)round(10 * (*value).value), 1, 5);
 
     myScreen.selectFont(Font_Terminal12x16);
-    char unit_c[4] = {0};
-    strcpy(unit_c, utf2iso(unit).c_str());
-    myScreen.gText(x0 + 3 * dx - myScreen.characterSizeX() * 0, y0 + 1 * dy - myScreen.characterSizeY(), formatString("%s", unit_c));
+    myScreen.gText(x0 + 3 * dx - myScreen.characterSizeX() * 0, y0 + 1 * dy - myScreen.characterSizeY(), unit); // UTF-8
 
     myScreen.selectFont(Font_Terminal8x12);
     myScreen.gText(x0, y0 + 3 * dy, "Minimum");
     myScreen.gText(x0 + 2 * dx, y0 + 3 * dy, "Maximum");
 
     myScreen.selectFont(Font_Terminal12x16);
-    myScreen.gText(x0, y0 + 4 * dy, formatString("%5.1f", (*value).minimum));
-    myScreen.gText(x0 + 2 * dx, y0 + 4 * dy, formatString("%5.1f", (*value).maximum));
+    myScreen.gNumber(x0, y0 + 4 * dy, (int32_t)round(10 * (*value).minimum), 1, 5);
+    myScreen.gNumber(x0 + 2 * dx, y0 + 4 * dy, (int32_t)round(10 * (*value).maximum), 1, 5);
 
     // for (uint8_t i = 0; i < 4; i += 1)
     // {
@@ -146,6 +143,7 @@ void setup()
     // Screen
     myScreen.begin();
     // myScreen.setPowerProfile(POWER_MODE_AUTO, POWER_SCOPE_GPIO_ONLY);
+    myScreen.setRefreshPolicy(refreshPolicyAdaptive); // Fast, global or regenerate
     myScreen.regenerate(); // Clear buffer and screen
 
     myScreen.setOrientation(3);
@@ -190,24 +188,16 @@ void loop()
         humidity.value = humidity.value / 65536.0 * 100.0;
 
         // Screen
-        countFlush %= FAST_BEFORE_GLOBAL;
-        if (countFlush == 0)
-        {
-            myScreen.regenerate();
-            mySerial.println("countFlush = 0 ! regenerate");
-            flagDisplay = true;
-        }
-
         flagDisplay |= displayValue(0, "Temperature", &temperature, "°C");
         flagDisplay |= displayValue(1, "Humidity", &humidity, "%");
         if (flagDisplay == true)
         {
-            countFlush += 1;
-            myScreen.flush();
+            myScreen.flush(); // Mode decided by the refresh policy
 
             flagDisplay = false;
 
-            mySerial.print(formatString("countFlush = %i", countFlush));
+            refreshDecision_s decision = myScreen.getRefreshDecision();
+            mySerial.print(formatString("Refresh mode = %i, reason = %i, fast updates = %i", decision.mode, decision.reason, decision.state.fastNumber));
             mySerial.println();
         }
 
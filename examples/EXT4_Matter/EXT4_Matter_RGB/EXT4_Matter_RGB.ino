@@ -86,8 +86,6 @@ rawWS2813C myRGB(1, myBoard.ledData);
 static bool wsState = false;
 const uint8_t wsLimit = 64; // Limit for each RGB channel
 
-static uint8_t countFlush = 1; // Counter for global update
-const uint8_t FAST_BEFORE_GLOBAL = 8; // Number of fast updates before global update
 bool flagDisplay = true; // Call screen refresh
 
 struct hsb_s
@@ -453,8 +451,10 @@ uint8_t menuOneButton(uint8_t button, const char * title, const char * option1,
                 myScreen.dRectangle(0, bar_y0, x, 4, myColours.white);
                 myScreen.dRectangle(options_index * options_dx, bar_y0, options_dx * delay_count / delay_s, 2, myColours.black);
                 myScreen.setPenSolid(false);
-                myScreen.flush();
+                myScreen.requestFlush(); // Merged if previous refresh too recent
             }
+
+            myScreen.serviceFlush();
         }
         result = options_index + 1;
 
@@ -567,6 +567,8 @@ void setup()
     // Start
     myScreen.begin();
     myScreen.setPowerProfile(POWER_MODE_AUTO, POWER_SCOPE_GPIO_ONLY);
+    myScreen.setRefreshPolicy(refreshPolicyAdaptive); // Fast, global or regenerate
+    myScreen.setFlushInterval(1000); // At most one requested refresh per second
     myScreen.regenerate(); // Clear buffer and screen
 
     myScreen.setOrientation(ORIENTATION_LANDSCAPE);
@@ -745,15 +747,8 @@ void loop()
     // Screen
     if (flagDisplay == true)
     {
-        countFlush += 1;
-        countFlush %= FAST_BEFORE_GLOBAL;
-        if (countFlush == 0)
-        {
-            myScreen.regenerate();
-            mySerial.println("countFlush = 0 ! regenerate");
-        }
         displayValue();
-        myScreen.flush();
+        myScreen.flush(); // Mode decided by the refresh policy
 
         flagDisplay = false;
     }
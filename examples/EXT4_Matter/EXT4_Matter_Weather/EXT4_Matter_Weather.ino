@@ -64,6 +64,9 @@ MatterHumidity myMatterHumidity;
 // Configuration
 #include "hV_Configuration.h"
 
+// Text fields
+#include "hV_TextField.h"
+
 #if (USE_EXT_BOARD != BOARD_EXT4)
 #error Required USE_EXT_BOARD = BOARD_EXT4
 #endif // USE_EXT_BOARD
@@ -80,6 +83,7 @@ Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, myBoard);
 
 #define MATTER_EXAMPLE_NAME "Matter Weather"
 #define MATTER_EXAMPLE_RELEASE 812
+#define PAGE_ABOUT 1 ///< Page number for the page cache
 
 // HDC2080
 
@@ -101,10 +105,15 @@ struct measure_s
 measure_s temperature;
 measure_s humidity;
 
+// Value, minimum and maximum, per slot
+hV_TextField fieldValue[2] = { hV_TextField(&myScreen), hV_TextField(&myScreen) };
+hV_TextField fieldMinimum[2] = { hV_TextField(&myScreen), hV_TextField(&myScreen) };
+hV_TextField fieldMaximum[2] = { hV_TextField(&myScreen), hV_TextField(&myScreen) };
+area_s areaDisplay;
+
 static uint32_t chrono32 = 0;
-static uint8_t countFlush = 1; // Counter for global update
-const uint8_t FAST_BEFORE_GLOBAL = 8; // Number of fast updates before global update
 bool flagDisplay = true;
+bool flagLabels = true;
 
 // Prototypes
 
@@ -136,8 +145,10 @@ void displayQR(const char * code);
 /// * value rounded to one decimal
 /// * min and max values updated
 /// * old value updated
+/// * labels drawn only if flagLabels, otherwise only the characters changed
+/// * area modified added to areaDisplay
 ///
-bool displayValue(uint8_t slot, String name, measure_s * value, String unit);
+bool displayValue(uint8_t slot, const char * name, measure_s * value, const char * unit);
 
 ///
 /// @brief Display a menu managed by a single button
@@ -216,7 +227,7 @@ void displayQR(const char * code)
 // --- End of QR-code
 
 // --- Screen
-bool displayValue(uint8_t slot, String name, measure_s * value, String unit)
+bool displayValue(uint8_t slot, const char * name, measure_s * value, const char * unit)
 {
     uint16_t x = myScreen.screenSizeX();
     uint16_t y = myScreen.screenSizeY();
@@ -233,28 +244,41 @@ bool displayValue(uint8_t slot, String name, measure_s * value, String unit)
     (*value).maximum = hV_HAL_max((*value).maximum, (*value).value);
     (*value).minimum = hV_HAL_min((*value).minimum, (*value).value);
 
-    myScreen.setPenSolid(true);
-    myScreen.setFontSolid(true);
-    myScreen.dRectangle(x0, y0, dx * 4, dy * 4, myColours.white);
+    // Labels, after clear() or menu only
+    if (flagLabels)
+    {
+        myScreen.setPenSolid(true);
+        myScreen.setFontSolid(true);
+        myScreen.dRectangle(x0, y0, dx * 4, dy * 4, myColours.white);
+        myScreen.setPenSolid(false);
 
-    myScreen.selectFont(Font_Terminal12x16);
-    myScreen.gText(x0, y0, name);
+        myScreen.selectFont(Font_Terminal12x16);
+        myScreen.gText(x0, y0, name);
+        myScreen.gText(x0 + 3 * dx - myScreen.characterSizeX() * 0, y0 + 1 * dy - myScreen.characterSizeY(), unit); // UTF-8
 
-    myScreen.selectFont(Font_Terminal16x24);
-    myScreen.gTextLarge(x0, y0 + 1 * dy, formatString("%5.1f", (*value).value));
+        myScreen.selectFont(Font_Terminal8x12);
+        myScreen.gText(x0, y0 + 3 * dy, "Minimum");
+        myScreen.gText(x0 + 2 * dx, y0 + 3 * dy, "Maximum");
 
-    myScreen.selectFont(Font_Terminal12x16);
-    char unit_c[4] = {0};
-    strcpy(unit_c, utf2iso(unit).c_str());
-    myScreen.gText(x0 + 3 * dx - myScreen.characterSizeX() * 0, y0 + 1 * dy - myScreen.characterSizeY(), formatString("%s", unit_c));
+        addArea(areaDisplay, x0, y0, dx * 4, dy * 4);
 
-    myScreen.selectFont(Font_Terminal8x12);
-    myScreen.gText(x0, y0 + 3 * dy, "Minimum");
-    myScreen.gText(x0 + 2 * dx, y0 + 3 * dy, "Maximum");
+        fieldValue[slot].invalidate();
+        fieldMinimum[slot].invalidate();
+        fieldMaximum[slot].invalidate();
+    }
 
-    myScreen.selectFont(Font_Terminal12x16);
-    myScreen.gText(x0, y0 + 4 * dy, formatString("%5.1f", (*value).minimum));
-    myScreen.gText(x0 + 2 * dx, y0 + 4 * dy, formatString("%5.1f", (*value).maximum));
+    // Fixed-point x10, only the characters changed are drawn
+    fieldValue[slot].setField(x0, y0 + 1 * dy, 5, Font_Terminal16x24, 2);
+    fieldValue[slot].updateNumber((int32_t)round(10 * (*value).value), 1);
+    addArea(areaDisplay, fieldValue[slot].getDirty());
+
+    fieldMinimum[slot].setField(x0, y0 + 4 * dy, 5, Font_Terminal12x16);
+    fieldMinimum[slot].updateNumber((int32_t)round(10 * (*value).minimum), 1);
+    addArea(areaDisplay, fieldMinimum[slot].getDirty());
+
+    fieldMaximum[slot].setField(x0 + 2 * dx, y0 + 4 * dy, 5, Font_Terminal12x16);
+    fieldMaximum[slot].updateNumber((int32_t)round(10 * (*value).maximum), 1);
+    addArea(areaDisplay, fieldMaximum[slot].getDirty());
 
     // for (uint8_t i = 0; i < 4; i += 1)
     // {
@@ -262,12 +286,22 @@ bool displayValue(uint8_t slot, String name, measure_s * value, String unit)
     //     myScreen.line(x0 + i * dx, y0, x0 + i * dx, y0 + y, myColours.grey);
     // }
 
-    myScreen.setPenSolid(false);
     return result;
 }
 
 void displayAbout()
 {
+#if (PAGE_CACHE == USE_PAGE_CACHE_YES)
+    // Drawn once, then restored from the page cache
+    if (myScreen.loadPage(PAGE_ABOUT, MATTER_EXAMPLE_RELEASE) == RESULT_SUCCESS)
+    {
+        myScreen.flush();
+        delay(10000);
+        myScreen.clear();
+        return;
+    }
+#endif // PAGE_CACHE
+
     myScreen.clear();
 
     myScreen.selectFont(Font_Terminal12x16);
@@ -318,6 +352,10 @@ void displayAbout()
 
     displayQR("https://www.pervasivedisplays.com");
 
+#if (PAGE_CACHE == USE_PAGE_CACHE_YES)
+    myScreen.savePage(PAGE_ABOUT, MATTER_EXAMPLE_RELEASE);
+#endif // PAGE_CACHE
+
     myScreen.flush();
     delay(10000);
     myScreen.clear();
@@ -438,8 +476,10 @@ uint8_t menuOneButton(uint8_t button, const char * title, const char * option1,
                 myScreen.dRectangle(0, bar_y0, x, 4, myColours.white);
                 myScreen.dRectangle(options_index * options_dx, bar_y0, options_dx * delay_count / delay_s, 2, myColours.black);
                 myScreen.setPenSolid(false);
-                myScreen.flush();
+                myScreen.requestFlush(); // Merged if previous refresh too recent
             }
+
+            myScreen.serviceFlush();
         }
         result = options_index + 1;
 
@@ -553,6 +593,8 @@ void setup()
     // Start
     myScreen.begin();
     myScreen.setPowerProfile(POWER_MODE_AUTO, POWER_SCOPE_GPIO_ONLY);
+    myScreen.setRefreshPolicy(refreshPolicyAdaptive); // Fast, global or regenerate
+    myScreen.setFlushInterval(1000); // At most one requested refresh per second
     myScreen.regenerate(); // Clear buffer and screen
 
     myScreen.setOrientation(3);
@@ -663,6 +705,7 @@ void loop()
     if (action > 0)
     {
         flagDisplay = true;
+        flagLabels = true;
         chrono32 = millis();
     }
 
@@ -738,24 +781,19 @@ void loop()
         // --- End of Matter
 
         // Screen
-        countFlush %= FAST_BEFORE_GLOBAL;
-        if (countFlush == 0)
-        {
-            myScreen.regenerate();
-            mySerial.println("countFlush = 0 ! regenerate");
-            flagDisplay = true;
-        }
-
+        areaDisplay = { 0, 0, 0, 0 };
         flagDisplay |= displayValue(0, "Temperature", &temperature, "°C");
         flagDisplay |= displayValue(1, "Humidity", &humidity, "%");
+        flagLabels = false;
         if (flagDisplay == true)
         {
-            countFlush += 1;
-            myScreen.flush();
+            myScreen.flush(); // Mode decided by the refresh policy
 
             flagDisplay = false;
+            mySerial.println(formatString("Area modified = %i x %i at (%i, %i)", areaDisplay.dx, areaDisplay.dy, areaDisplay.x0, areaDisplay.y0));
 
-            mySerial.print(formatString("countFlush = %i", countFlush));
+            refreshDecision_s decision = myScreen.getRefreshDecision();
+            mySerial.print(formatString("Refresh mode = %i, reason = %i, fast updates = %i", decision.mode, decision.reason, decision.state.fastNumber));
             mySerial.println();
         }
 
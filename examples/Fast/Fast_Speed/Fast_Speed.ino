@@ -28,6 +28,7 @@
 /// Release 542: First release
 /// Release 604: Global and fast variants
 /// Release 702: Added xE2150KS0Jx and xE2152KS0Jx
+/// Release 830: Added energy report
 ///
 
 // Screen
@@ -59,6 +60,19 @@ Screen_EPD_EXT4_Fast myScreen(eScreen_EPD_290_KS_0F, boardArduinoNanoMatter);
 // Prototypes
 
 // Utilities
+///
+/// @brief Display the energy report of last flush
+///
+void displayEnergy()
+{
+    energyReport_s report = myScreen.getEnergyReport();
+
+    mySerial.println(formatString("Reset= %i us, power-on= %i us, transfer= %i us, busy= %i us, total= %i us",
+                                  report.time.reset, report.time.powerOn, report.time.transfer, report.time.busy, report.time.total));
+    mySerial.println(formatString("Energy= %i uJ, cumulated= %i mJ for %i flushes",
+                                  report.energy, report.energyTotal, report.flushNumber));
+}
+
 ///
 /// @brief Wait with countdown
 /// @param second duration, s
@@ -101,9 +115,9 @@ void performTest()
     myScreen.gText(dx, dy, text);
     myScreen.dRectangle(0, dz * 0, x, dz, myColours.black);
 
-    chrono = millis();
     myScreen.flush();
-    chrono = millis() - chrono;
+    chrono = myScreen.getEnergyReport().time.total / 1000; // us to ms
+    displayEnergy();
 
     // 1
     dy += dz;
@@ -115,6 +129,7 @@ void performTest()
     myScreen.dRectangle(0, dz * 1, x, dz, myColours.black);
 
     myScreen.flush();
+    displayEnergy();
 }
 
 // Add setup code
@@ -0,0 +1,362 @@
+#!/usr/bin/env python3
+#
+# bdf2pdls.py
+# Host-side converter for proportional fonts
+# ----------------------------------
+#
+# Project Pervasive Displays Library Suite
+# Based on highView technology
+#
+# Created by Rei Vilo, 21 Jun 2025
+#
+# Copyright (c) Rei Vilo, 2010-2025
+# Licence Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+#
+# Release 830: Initial release
+# Release 830: Added binary image for fonts on external SPI Flash
+# Release 830: Added sparse ranges of code points
+#
+# Generate a proportional font header for hV_Font_Terminal from
+# * a BDF font, or
+# * a monospaced Terminal font header of the library, with --terminal
+#
+# Format of the generated header
+# * NAME_column[number + 1]: first column of each character, last = total,
+#   so width = column[c + 1] - column[c] and index = column[c] * bytes per column
+# * NAME_table[]: columns, LSB at top, (height + 7) / 8 bytes per column
+# * NAME_range[]: with --ranges or --text, ranges of code points
+#   {first, last, glyph}, sorted, so glyph of p = glyph + p - first
+# * NAME_font: font_s structure for addFont()
+#
+# Without --ranges or --text, the font covers ISO-8859-1 0x20~0xff, with Euro sign on 0x80
+# With --ranges or --text, the font includes only the selected code points, up to 224
+#
+# Format of the binary image with --binary, for external SPI Flash, little endian
+# * header, 12 bytes: 'h' 'V' 'F' 0x01, kind, height, maxWidth, first, number, ranges, 2 reserved
+# * range[ranges], 6 bytes each: first uint16_t, last uint16_t, glyph, 1 reserved
+# * column[number + 1], uint16_t
+# * table, as for the header
+#
+# Examples
+#   python3 bdf2pdls.py --terminal ../src/Terminal8x12e.h --width 8 --height 12 --name Terminal8x12p
+#   python3 bdf2pdls.py helvR12.bdf --name Helvetica12p > ../src/Helvetica12p.h
+#   python3 bdf2pdls.py helvB34.bdf --name Helvetica34p --binary > Helvetica34p.bin
+#   python3 bdf2pdls.py 7x13.bdf --name Cyrillic13p --ranges 0x20-0x7e,0x401,0x410-0x44f,0x451 > Cyrillic13p.h
+#   python3 bdf2pdls.py 7x13.bdf --name Labels13p --text "Teplota Vlhkost 0123456789 °C %" > Labels13p.h
+#
+# The binary image is then written to the SPI Flash with a programmer,
+# and added with addFontFlash(address)
+#
+# The header is included in the sketch after the library,
+# with hV_FONT_TERMINAL_DEFINITION defined in one file only, and added with addFont(NAME_font)
+#
+
+import argparse
+import re
+import sys
+
+FIRST = 0x20
+NUMBER = 224
+DIGITS = [ord(c) for c in "0123456789"]
+
+
+def iso_code(c):
+    """Code point of ISO-8859-1 character c, with Euro sign on 0x80"""
+    return 0x20ac if c == 0x80 else c
+
+
+def parse_ranges(text):
+    """Parse 0x20-0x7e,0x401 into a sorted list of code points"""
+    codes = set()
+    for item in text.split(","):
+        bounds = [int(x, 0) for x in item.split("-")]
+        codes.update(range(bounds[0], bounds[-1] + 1))
+    return sorted(codes)
+
+
+def make_ranges(codes):
+    """Group sorted code points into ranges of consecutive code points"""
+    ranges = []
+    for glyph, code in enumerate(codes):
+        if ranges and ranges[-1][1] == code - 1:
+            ranges[-1][1] = code
+        else:
+            ranges.append([code, code, glyph])
+    return ranges
+
+
+def read_terminal(path, width, height):
+    """Read a monospaced Terminal header, return glyphs as lists of column bitmasks, by code point"""
+    text = open(path, encoding="latin-1").read()
+    text = text[text.index("{", text.index("=")):]
+    text = re.sub(r"//[^\n]*", "", text)
+    values = [int(x, 16) for x in re.findall(r"0x([0-9A-Fa-f]{2})", text)]
+
+    size = len(values) // NUMBER
+    rows = (height + 7) // 8
+    glyphs = {}
+    for c in range(NUMBER):
+        data = values[c * size:(c + 1) * size]
+        columns = []
+        for i in range(width):
+            if size == width * rows:
+                value = 0
+                for b in range(rows):
+                    value |= data[rows * i + b] << (8 * b)
+            elif (height == 12) and (size == width + width // 2):
+                # Bit-packed Terminal8x12e, rows 8~11 on nibbles
+                value = data[i] | (((data[width + i // 2] >> (4 * (i % 2))) & 0x0f) << 8)
+            else:
+                sys.exit("Unknown layout: %i bytes per character" % size)
+            columns.append(value & ((1 << height) - 1))
+        glyphs[iso_code(c + FIRST)] = columns
+
+    return glyphs, width // 2
+
+
+def read_bdf(path):
+    """Read a BDF font, return glyphs as lists of column bitmasks by code point, height and space width"""
+    ascent = descent = None
+    glyphs = {}
+    encoding = -1
+    dwidth = bbx = None
+    bitmap = None
+    for line in open(path, encoding="latin-1"):
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "ENCODING":
+            encoding = int(words[1])
+        elif words[0] == "DWIDTH":
+            dwidth = int(words[1])
+        elif words[0] == "BBX":
+            bbx = [int(x) for x in words[1:5]]
+        elif words[0] == "BITMAP":
+            bitmap = []
+        elif words[0] == "ENDCHAR":
+            glyphs[encoding] = (dwidth, bbx, bitmap)
+            bitmap = None
+        elif bitmap is not None:
+            bitmap.append(int(words[0], 16) << (8 * ((bbx[0] + 7) // 8) - len(words[0]) * 4))
+
+    if (ascent is None) or (descent is None):
+        sys.exit("Missing FONT_ASCENT or FONT_DESCENT")
+
+    height = ascent + descent
+    result = {}
+    for code in glyphs:
+        dwidth, (w, h, xo, yo), rows = glyphs[code]
+        # Negative x-offset, glyph widened on the left by the overhang
+        shift = -min(xo, 0)
+        xo += shift
+        columns = [0] * max(dwidth + shift, xo + w)
+        for r, bits in enumerate(rows):
+            y = ascent - (yo + h) + r
+            if (y < 0) or (y >= height):
+                continue
+            for x in range(w):
+                if bits & (1 << (8 * ((w + 7) // 8) - 1 - x)):
+                    columns[xo + x] |= 1 << y
+        result[code] = columns
+
+    space = glyphs.get(0x20, (height // 3, None, None))[0]
+    return result, height, space
+
+
+def trim(columns):
+    """Remove empty columns on both sides"""
+    while columns and columns[0] == 0:
+        columns = columns[1:]
+    while columns and columns[-1] == 0:
+        columns = columns[:-1]
+    return columns
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate a proportional font header for PDLS")
+    parser.add_argument("bdf", nargs="?", help="BDF font file")
+    parser.add_argument("--terminal", help="monospaced Terminal header instead of BDF")
+    parser.add_argument("--width", type=int, help="Terminal font width")
+    parser.add_argument("--height", type=int, help="Terminal font height")
+    parser.add_argument("--name", required=True, help="font name, eg. Terminal8x12p")
+    parser.add_argument("--proportional-digits", action="store_true", help="do not align digits on the same width")
+    parser.add_argument("--binary", action="store_true", help="binary image for external SPI Flash instead of header")
+    parser.add_argument("--ranges", help="code points to include, eg. 0x20-0x7e,0x410-0x44f")
+    parser.add_argument("--text", help="include the code points of the text, UTF-8")
+    arguments = parser.parse_args()
+
+    if arguments.terminal:
+        if not (arguments.width and arguments.height):
+            sys.exit("--terminal requires --width and --height")
+        glyphs, space = read_terminal(arguments.terminal, arguments.width, arguments.height)
+        height = arguments.height
+        source = arguments.terminal.split("/")[-1]
+    elif arguments.bdf:
+        glyphs, height, space = read_bdf(arguments.bdf)
+        source = arguments.bdf.split("/")[-1]
+    else:
+        sys.exit("BDF file or --terminal required")
+
+    # Code points, ISO-8859-1 by default or sparse
+    ranges = []
+    if arguments.ranges or arguments.text:
+        codes = set()
+        if arguments.ranges:
+            codes.update(parse_ranges(arguments.ranges))
+        if arguments.text:
+            codes.update(ord(c) for c in arguments.text)
+        codes.add(0x20)  # space
+        codes = sorted(code for code in codes if code >= 0x20)
+        if len(codes) > NUMBER:
+            sys.exit("Too many code points, %i for %i" % (len(codes), NUMBER))
+        if codes[-1] > 0xffff:
+            sys.exit("Code point out of Basic Multilingual Plane, 0x%x" % codes[-1])
+        missing = [code for code in codes if code not in glyphs]
+        if missing:
+            sys.stderr.write("Missing glyphs, replaced by space: %s\n" % " ".join("0x%x" % code for code in missing))
+        ranges = make_ranges(codes)
+    else:
+        codes = [iso_code(c + FIRST) for c in range(NUMBER)]
+    number = len(codes)
+
+    glyphs = [trim(glyphs.get(code, [])) for code in codes]
+    glyphs[codes.index(0x20)] = [0] * max(space, 1)  # space
+    for c in range(number):
+        if not glyphs[c]:
+            glyphs[c] = [0] * max(space, 1)
+
+    # Tabular digits, centred on the widest digit
+    digits = [codes.index(code) for code in DIGITS if code in codes]
+    if digits and not arguments.proportional_digits:
+        digitWidth = max(len(glyphs[c]) for c in digits)
+        for c in digits:
+            before = (digitWidth - len(glyphs[c])) // 2
+            glyphs[c] = [0] * before + glyphs[c] + [0] * (digitWidth - len(glyphs[c]) - before)
+
+    rows = (height + 7) // 8
+    maxWidth = max(len(columns) for columns in glyphs)
+    column = [0]
+    for columns in glyphs:
+        column.append(column[-1] + len(columns))
+    if column[-1] > 0xffff:
+        sys.exit("Font too large, %i columns" % column[-1])
+
+    if arguments.binary:
+        if maxWidth > 0xff:
+            sys.exit("Font too wide, %i pixels" % maxWidth)
+        data = bytearray(b"hVF\x01")
+        data += bytes([0x20, height, maxWidth, FIRST, number, len(ranges), 0, 0])
+        for first, last, glyph in ranges:
+            data += bytes([first & 0xff, first >> 8, last & 0xff, last >> 8, glyph, 0])
+        for value in column:
+            data += bytes([value & 0xff, value >> 8])
+        for columns in glyphs:
+            for value in columns:
+                for b in range(rows):
+                    data.append((value >> (8 * b)) & 0xff)
+        sys.stdout.buffer.write(data)
+        return
+
+    name = arguments.name
+    guard = name.upper() + "_FONT_RELEASE"
+    out = []
+    out.append("///")
+    out.append("/// @file %s.h" % name)
+    out.append("/// @brief Proportional font %s" % name)
+    out.append("///")
+    out.append("/// @details Project Pervasive Displays Library Suite")
+    out.append("/// @n Based on highView technology")
+    out.append("/// @n Generated by extras/bdf2pdls.py from %s" % source)
+    out.append("/// @n Height %i, maximum width %i, %i bytes per column, %i columns" % (height, maxWidth, rows, column[-1]))
+    out.append("///")
+    out.append("/// @author Rei Vilo")
+    out.append("/// @date 21 Jun 2025")
+    out.append("/// @version 830")
+    out.append("///")
+    out.append("/// @copyright (c) Rei Vilo, 2010-2025")
+    out.append("/// @copyright All rights reserved")
+    out.append("/// @copyright For exclusive use with Pervasive Displays screens")
+    out.append("///")
+    out.append("/// * Basic edition: for hobbyists and for basic usage")
+    out.append("/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)")
+    out.append("/// @see https://creativecommons.org/licenses/by-sa/4.0/")
+    out.append("///")
+    out.append("")
+    out.append("#ifndef %s" % guard)
+    out.append("///")
+    out.append("/// @brief Release")
+    out.append("///")
+    out.append("#define %s 830" % guard)
+    out.append("")
+    out.append("///")
+    out.append("/// @brief Maximum width of %s, in pixels" % name)
+    out.append("///")
+    out.append("#define %s_MAX_WIDTH %i" % (name.upper(), maxWidth))
+    out.append("")
+    out.append("extern const uint16_t %s_column[%i];" % (name, number + 1))
+    out.append("extern const uint8_t %s_table[%i];" % (name, column[-1] * rows))
+    if ranges:
+        out.append("extern const range_s %s_range[%i];" % (name, len(ranges)))
+    out.append("extern const font_s %s_font;" % name)
+    out.append("")
+    out.append("#if defined(hV_FONT_TERMINAL_DEFINITION)")
+    out.append("///")
+    out.append("/// @brief First column of each character, last = total")
+    out.append("///")
+    out.append("const uint16_t %s_column[%i] =" % (name, number + 1))
+    out.append("{")
+    for k in range(0, number + 1, 16):
+        line = ", ".join("%i" % x for x in column[k:k + 16])
+        out.append("    " + line + ("," if k + 16 < number + 1 else ""))
+    out.append("};")
+    out.append("")
+    out.append("///")
+    out.append("/// @brief Columns of the characters")
+    out.append("///")
+    out.append("const uint8_t %s_table[%i] =" % (name, column[-1] * rows))
+    out.append("{")
+    for c, columns in enumerate(glyphs):
+        data = []
+        for value in columns:
+            for b in range(rows):
+                data.append((value >> (8 * b)) & 0xff)
+        line = ", ".join("0x%02X" % x for x in data)
+        if ranges:
+            out.append("    %s%s // U+%04X" % (line, "," if c < number - 1 else "", codes[c]))
+        else:
+            out.append("    %s%s // 0x%02x" % (line, "," if c < number - 1 else "", c + FIRST))
+    out.append("};")
+    out.append("")
+    if ranges:
+        out.append("///")
+        out.append("/// @brief Ranges of code points")
+        out.append("///")
+        out.append("const range_s %s_range[%i] =" % (name, len(ranges)))
+        out.append("{")
+        for k, (first, last, glyph) in enumerate(ranges):
+            out.append("    { 0x%04x, 0x%04x, %i }%s" % (first, last, glyph, "," if k < len(ranges) - 1 else ""))
+        out.append("};")
+        out.append("")
+    out.append("///")
+    out.append("/// @brief Font for addFont()")
+    out.append("///")
+    out.append("const font_s %s_font =" % name)
+    out.append("{")
+    out.append("    0x20, %i, %s_MAX_WIDTH, %i, %i, %s_column, %s_table, %s, %i" %
+               (height, name.upper(), FIRST, number, name, name,
+                ("%s_range" % name) if ranges else "nullptr", len(ranges)))
+    out.append("};")
+    out.append("#endif // hV_FONT_TERMINAL_DEFINITION")
+    out.append("")
+    out.append("#endif // %s" % guard)
+    out.append("")
+
+    sys.stdout.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
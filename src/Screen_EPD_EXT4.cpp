@@ -38,6 +38,21 @@
 // Release 804: Improved power management
 // Release 810: Added support for EXT4
 // Release 821: Added 437-PS-0C
+// Release 830: Added frame-buffer on external SPI SRAM or FRAM
+// Release 830: Added character cells for text mode
+// Release 830: Added cached GPIO configuration and power statistics
+// Release 830: Added energy report
+// Release 830: Added global update and refresh policies
+// Release 830: Added scroll along the native axis
+// Release 830: Added fonts on external SPI Flash
+// Release 830: Added display list
+// Release 830: Added background layer
+// Release 830: Added page cache
+// Release 830: Added scroll left of an area
+// Release 830: Added flush requests with coalescing
+// Release 830: Added rotation of the frame-buffer in place
+// Release 830: Added read pixel and flood fill
+// Release 830: Added ordered dithering for all colours
 //
 
 // Library header
@@ -97,6 +112,7 @@ void Screen_EPD_EXT4_Fast::COG_SmallKP_getDataOTP()
     // Read OTP
     uint8_t ui8 = 0;
     uint16_t _readBytes = 0;
+    char work[128];
     u_flagOTP = false;
 
     // Application note § 3. Read OTP memory
@@ -233,7 +249,8 @@ void Screen_EPD_EXT4_Fast::COG_SmallKP_getDataOTP()
 
         default:
 
-            mySerial.println(formatString("hV * OTP check failed - Screen %i-%cS-0%c not supported", u_codeSize, u_codeFilm, u_codeDriver));
+            snprintf(work, sizeof(work), "hV * OTP check failed - Screen %i-%cS-0%c not supported", u_codeSize, u_codeFilm, u_codeDriver);
+            mySerial.println(work);
             mySerial.flush();
             while (true);
             break;
@@ -256,7 +273,8 @@ void Screen_EPD_EXT4_Fast::COG_SmallKP_getDataOTP()
         if (ui8 != 0xa5)
         {
             mySerial.println();
-            mySerial.println(formatString("hV * OTP check failed - Bank %i, first 0x%02x, expected 0x%02x", bank, ui8, 0xa5));
+            snprintf(work, sizeof(work), "hV * OTP check failed - Bank %i, first 0x%02x, expected 0x%02x", bank, ui8, 0xa5);
+            mySerial.println(work);
             mySerial.flush();
             while (true);
         }
@@ -270,12 +288,14 @@ void Screen_EPD_EXT4_Fast::COG_SmallKP_getDataOTP()
         // case eScreen_EPD_287_KS_09:
         case eScreen_EPD_287_PS_09:
 
-            mySerial.println(formatString("hV . OTP check passed - Bank %i, first 0x%02x %s", bank, ui8, (bank == 0) ? "as expected" : "not checked"));
+            snprintf(work, sizeof(work), "hV . OTP check passed - Bank %i, first 0x%02x %s", bank, ui8, (bank == 0) ? "as expected" : "not checked");
+            mySerial.println(work);
             break;
 
         default:
 
-            mySerial.println(formatString("hV . OTP check passed - Bank %i, first 0x%02x as expected", bank, ui8));
+            snprintf(work, sizeof(work), "hV . OTP check passed - Bank %i, first 0x%02x as expected", bank, ui8);
+            mySerial.println(work);
             break;
     }
 
@@ -376,8 +396,14 @@ void Screen_EPD_EXT4_Fast::COG_SmallKP_initial(uint8_t updateMode)
 void Screen_EPD_EXT4_Fast::COG_SmallKP_sendImageData(uint8_t updateMode)
 {
     // Application note § 5. Input image to the EPD
-    FRAMEBUFFER_TYPE nextBuffer = s_newImage;
-    FRAMEBUFFER_TYPE previousBuffer = s_newImage + u_pageColourSize;
+    uint32_t nextOffset = 0;
+    uint32_t previousOffset = u_pageColourSize;
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    s_cacheFlush(); // Modified lines into external memory
+
+#endif // SRAM_MODE
 
     // Send image data
     // case UPDATE_FAST:
@@ -386,19 +412,34 @@ void Screen_EPD_EXT4_Fast::COG_SmallKP_sendImageData(uint8_t updateMode)
         case eScreen_EPD_150_KS_0J:
         case eScreen_EPD_152_KS_0J:
 
-            b_sendIndexData(0x24, previousBuffer, u_pageColourSize); // Next frame, blackBuffer
-            b_sendIndexData(0x26, nextBuffer, u_pageColourSize); // Previous frame, 0x00
+            if (updateMode == UPDATE_GLOBAL)
+            {
+                s_sendIndexFrame(0x24, nextOffset); // Next frame, blackBuffer
+                b_sendIndexFixed(0x26, 0x00, u_pageColourSize); // Previous frame, 0x00
+                break;
+            }
+
+            s_sendIndexFrame(0x24, previousOffset); // Next frame, blackBuffer
+            s_sendIndexFrame(0x26, nextOffset); // Previous frame, 0x00
             break;
 
         default:
+
+            if (updateMode == UPDATE_GLOBAL)
+            {
+                s_sendIndexFrame(0x10, nextOffset); // First frame, blackBuffer
+                b_sendIndexFixed(0x13, 0x00, u_pageColourSize); // Second frame, 0x00
+                break;
+            }
+
             // Additional settings for fast update, 154 213 266 370 and 437 screens (s_flag50)
             if (s_flag50)
             {
                 b_sendCommandData8(0x50, 0x27); // Vcom and data interval setting
             }
 
-            b_sendIndexData(0x10, previousBuffer, u_pageColourSize); // First frame, blackBuffer
-            b_sendIndexData(0x13, nextBuffer, u_pageColourSize); // Second frame, 0x00
+            s_sendIndexFrame(0x10, previousOffset); // First frame, blackBuffer
+            s_sendIndexFrame(0x13, nextOffset); // Second frame, 0x00
 
             // Additional settings for fast update, 154 213 266 370 and 437 screens (s_flag50)
             if (s_flag50)
@@ -408,8 +449,48 @@ void Screen_EPD_EXT4_Fast::COG_SmallKP_sendImageData(uint8_t updateMode)
             break;
     } // u_eScreen_EPD
 
+#if (SRAM_MODE == USE_INTERNAL_MCU)
+
     // Copy next frame to previous frame
-    memcpy(previousBuffer, nextBuffer, u_pageColourSize); // Copy displayed next to previous
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+    // Previous frame already composed by s_sendIndexFrame()
+    if (s_backgroundLength == 0)
+    {
+        memcpy(s_newImage + previousOffset, s_newImage + nextOffset, u_pageColourSize); // Copy displayed next to previous
+    }
+#else
+    memcpy(s_newImage + previousOffset, s_newImage + nextOffset, u_pageColourSize); // Copy displayed next to previous
+#endif // BACKGROUND_MODE
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Copy next cells to previous cells
+    memcpy(s_cellPrevious, s_cellNext, s_cellNumber);
+    memcpy(s_attributePrevious, s_attributeNext, (s_cellNumber + 7) / 8);
+    s_cellRowChanged = 0;
+
+#endif // SRAM_MODE
+}
+
+void Screen_EPD_EXT4_Fast::COG_SmallKP_sendFixedData(uint8_t data)
+{
+    // Application note § 5. Input image to the EPD
+    // Global update with fixed pattern, frame-buffer unchanged
+    switch (u_eScreen_EPD)
+    {
+        case eScreen_EPD_150_KS_0J:
+        case eScreen_EPD_152_KS_0J:
+
+            b_sendIndexFixed(0x24, data, u_pageColourSize); // Next frame, blackBuffer
+            b_sendIndexFixed(0x26, 0x00, u_pageColourSize); // Previous frame, 0x00
+            break;
+
+        default:
+
+            b_sendIndexFixed(0x10, data, u_pageColourSize); // First frame, blackBuffer
+            b_sendIndexFixed(0x13, 0x00, u_pageColourSize); // Second frame, 0x00
+            break;
+    }
 }
 
 void Screen_EPD_EXT4_Fast::COG_SmallKP_update(uint8_t updateMode)
@@ -473,6 +554,47 @@ Screen_EPD_EXT4_Fast::Screen_EPD_EXT4_Fast(eScreen_EPD_t eScreen_EPD_EXT3, pins_
     b_pin = board;
     s_newImage = 0; // nullptr
     COG_data[0] = 0;
+
+    // Indicative values
+    s_energyModel = { 3300, 1000, 1000, 2500, 4000 };
+    resetEnergyReport();
+
+    // Dithering
+    s_ditherMatrix = DITHER_4X4;
+    s_ditherColour = myColours.white;
+    s_ditherLevel = 0;
+
+    // Refresh
+    s_refreshPolicy = refreshPolicyFast;
+    memset(&s_refreshState, 0x00, sizeof(s_refreshState));
+    memset(&s_refreshDecision, 0x00, sizeof(s_refreshDecision));
+    s_flushInterval = 0;
+    s_flushDeadline = 0;
+    s_flushLast = 0;
+    s_flushPendingSince = 0;
+    s_flagFlushLast = false;
+    s_flagFlushPending = false;
+    s_flagFlushBusy = false;
+    memset(&s_flushStatistics, 0x00, sizeof(s_flushStatistics));
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+    s_cellColumns = 0;
+    s_cellRows = 0;
+    s_cellRowChanged = 0;
+#endif // SRAM_MODE
+
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+    s_backgroundLength = 0;
+    s_backgroundMode = BACKGROUND_OR;
+    s_backgroundLine = nullptr;
+#endif // BACKGROUND_MODE
+
+#if (PAGE_CACHE == USE_PAGE_CACHE_YES)
+    s_pageCount = 0;
+    s_pageBytes = 0;
+    s_pageClock = 0;
+    memset(&s_pageStatistics, 0x00, sizeof(s_pageStatistics));
+#endif // PAGE_CACHE
 }
 
 void Screen_EPD_EXT4_Fast::begin()
@@ -483,6 +605,7 @@ void Screen_EPD_EXT4_Fast::begin()
     u_codeDriver = SCREEN_DRIVER(u_eScreen_EPD);
     u_codeExtra = SCREEN_EXTRA(u_eScreen_EPD);
     v_screenColourBits = 2; // BWR and BWRY
+    char work[128];
 
     //
     // === EXT4 section
@@ -519,6 +642,36 @@ void Screen_EPD_EXT4_Fast::begin()
     // === End of touch section
     //
 
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+    //
+    // === External SPI memory section
+    //
+    if (b_pin.flashCSS == NOT_CONNECTED)
+    {
+        mySerial.println();
+        mySerial.println("hV * Required pin flashCSS is NOT_CONNECTED");
+        while (0x01);
+    }
+    //
+    // === End of External SPI memory section
+    //
+#endif // SRAM_MODE
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+    //
+    // === Fonts on SPI Flash section
+    //
+    if (b_pin.flashCS == NOT_CONNECTED)
+    {
+        mySerial.println();
+        mySerial.println("hV * Required pin flashCS is NOT_CONNECTED");
+        while (0x01);
+    }
+    //
+    // === End of Fonts on SPI Flash section
+    //
+#endif // FONT_FLASH
+
     //
     // === Large screen section
     //
@@ -680,16 +833,22 @@ void Screen_EPD_EXT4_Fast::begin()
         default:
 
             mySerial.println();
-            mySerial.println(formatString("hV * Screen %i-%cS-0%c is not supported", u_codeSize, u_codeFilm, u_codeDriver));
+            snprintf(work, sizeof(work), "hV * Screen %i-%cS-0%c is not supported", u_codeSize, u_codeFilm, u_codeDriver);
+            mySerial.println(work);
             while (0x01);
             break;
     } // u_codeSize
     v_screenDiagonal = u_codeSize;
 
     // Report
-    mySerial.println(formatString("hV = Screen %s %ix%i", WhoAmI().c_str(), screenSizeX(), screenSizeY()));
-    mySerial.println(formatString("hV = Number %i-%cS-0%c", u_codeSize, u_codeFilm, u_codeDriver));
-    mySerial.println(formatString("hV = PDLS %s v%i.%i.%i", SCREEN_EPD_EXT3_VARIANT, SCREEN_EPD_EXT3_RELEASE / 100, (SCREEN_EPD_EXT3_RELEASE / 10) % 10, SCREEN_EPD_EXT3_RELEASE % 10));
+    char variant[64] = {0};
+    u_WhoAmI(variant);
+    snprintf(work, sizeof(work), "hV = Screen iTC %i.%02i\"%s %ix%i", v_screenDiagonal / 100, v_screenDiagonal % 100, variant, screenSizeX(), screenSizeY());
+    mySerial.println(work);
+    snprintf(work, sizeof(work), "hV = Number %i-%cS-0%c", u_codeSize, u_codeFilm, u_codeDriver);
+    mySerial.println(work);
+    snprintf(work, sizeof(work), "hV = PDLS %s v%i.%i.%i", SCREEN_EPD_EXT3_VARIANT, SCREEN_EPD_EXT3_RELEASE / 100, (SCREEN_EPD_EXT3_RELEASE / 10) % 10, SCREEN_EPD_EXT3_RELEASE % 10);
+    mySerial.println(work);
     mySerial.println();
 
     u_bufferDepth = v_screenColourBits; // 2 colours
@@ -700,7 +859,46 @@ void Screen_EPD_EXT4_Fast::begin()
     // Actually for 1 colour; BWR requires 2 pages.
     u_pageColourSize = (uint32_t)u_bufferSizeV * (uint32_t)u_bufferSizeH;
 
-#if defined(BOARD_HAS_PSRAM) // ESP32 PSRAM specific case
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // Frame-buffers on external memory, only the cache in MCU internal SRAM
+    if (s_newImage == 0)
+    {
+        static uint8_t * _newFrameBuffer;
+        _newFrameBuffer = new uint8_t[EXTERNAL_SPI_CACHE_LINES * u_bufferSizeH];
+        s_newImage = (uint8_t *) _newFrameBuffer;
+    }
+
+    for (uint8_t index = 0; index < EXTERNAL_SPI_CACHE_LINES; index += 1)
+    {
+        s_cacheTag[index] = 0xffff;
+        s_cacheAge[index] = 0;
+        s_cacheDirty[index] = false;
+    }
+    s_cacheClock = 0;
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Character cells, for both orientations, and one line in MCU internal SRAM
+    s_cellNumber = hV_HAL_max((v_screenSizeV / 6) * (v_screenSizeH / 8), (v_screenSizeH / 6) * (v_screenSizeV / 8));
+
+    if (s_newImage == 0)
+    {
+        static uint8_t * _newFrameBuffer;
+        _newFrameBuffer = new uint8_t[u_bufferSizeH + 2 * s_cellNumber + 2 * ((s_cellNumber + 7) / 8)];
+        s_newImage = (uint8_t *) _newFrameBuffer;
+    }
+
+    s_cellNext = s_newImage + u_bufferSizeH;
+    s_cellPrevious = s_cellNext + s_cellNumber;
+    s_attributeNext = s_cellPrevious + s_cellNumber;
+    s_attributePrevious = s_attributeNext + (s_cellNumber + 7) / 8;
+
+    // Spaces, no inverse
+    memset(s_cellNext, 0x00, 2 * s_cellNumber + 2 * ((s_cellNumber + 7) / 8));
+    s_cellRowChanged = 0;
+
+#elif defined(BOARD_HAS_PSRAM) // ESP32 PSRAM specific case
 
     if (s_newImage == 0)
     {
@@ -720,19 +918,48 @@ void Screen_EPD_EXT4_Fast::begin()
 
 #endif // ESP32 BOARD_HAS_PSRAM
 
+#if (SRAM_MODE == USE_INTERNAL_MCU)
+
     memset(s_newImage, 0x00, u_pageColourSize * u_bufferDepth);
 
+#endif // SRAM_MODE
+
     setTemperatureC(25); // 25 Celsius = 77 Fahrenheit
-    b_fsmPowerScreen = FSM_OFF;
+    b_setFsm(FSM_OFF);
     setPowerProfile(POWER_MODE_MANUAL, POWER_SCOPE_GPIO_ONLY);
 
     // Turn SPI on, initialise GPIOs and set GPIO levels
     // Reset panel and get tables
     resume();
 
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // External memory requires SPI
+    if (s_memory.begin(b_pin.flashCSS, EXTERNAL_SPI_KIND, EXTERNAL_SPI_ADDRESS_BYTES) == RESULT_ERROR)
+    {
+        mySerial.println();
+        mySerial.println("hV * External SPI memory not available");
+        while (0x01);
+    }
+    s_memory.fill(0, 0x00, u_pageColourSize * u_bufferDepth);
+
+#endif // SRAM_MODE
+
     // Fonts
     hV_Screen_Buffer::begin(); // Standard
 
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+
+    // Fonts on SPI Flash require SPI
+    if (f_flash.begin(b_pin.flashCS, EXTERNAL_SPI_FLASH, 3) == RESULT_ERROR)
+    {
+        mySerial.println();
+        mySerial.println("hV * External SPI Flash not available");
+        while (0x01);
+    }
+
+#endif // FONT_FLASH
+
     if (f_fontMax() > 0)
     {
         f_selectFont(0);
@@ -756,10 +983,13 @@ void Screen_EPD_EXT4_Fast::begin()
 
 STRING_TYPE Screen_EPD_EXT4_Fast::WhoAmI()
 {
-    char work[64] = {0};
-    u_WhoAmI(work);
+    char variant[64] = {0};
+    u_WhoAmI(variant);
 
-    return formatString("iTC %i.%02i\"%s", v_screenDiagonal / 100, v_screenDiagonal % 100, work);
+    char work[80];
+    snprintf(work, sizeof(work), "iTC %i.%02i\"%s", v_screenDiagonal / 100, v_screenDiagonal % 100, variant);
+
+    return STRING_TYPE(work);
 }
 
 void Screen_EPD_EXT4_Fast::suspend(uint8_t suspendScope)
@@ -780,13 +1010,14 @@ void Screen_EPD_EXT4_Fast::resume()
     //          FSM_SLEEP
     if (b_fsmPowerScreen != FSM_ON)
     {
+        uint32_t chrono = micros();
+        b_flagWarm = true; // Unless GPIOs configured
+
         if ((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK)
         {
-            b_resume(); // GPIO
-
-            s_reset(); // Reset
+            b_resume(); // GPIO, warm or cold
 
-            b_fsmPowerScreen |= FSM_GPIO_MASK;
+            s_reset(); // Reset, required after power cut
         }
 
         // Check type and get tables
@@ -824,11 +1055,29 @@ void Screen_EPD_EXT4_Fast::resume()
         hV_HAL_Wire_begin();
 
 #endif // USE_EXT_BOARD
+
+        b_setFsm(b_fsmPowerScreen | FSM_BUS_MASK);
+
+        // Statistics
+        chrono = micros() - chrono;
+        b_statistics.durationResume = chrono;
+        if (b_flagWarm)
+        {
+            b_statistics.resumeWarm += 1;
+            b_statistics.durationWarm += chrono;
+        }
+        else
+        {
+            b_statistics.resumeCold += 1;
+            b_statistics.durationCold += chrono;
+        }
     }
 }
 
 void Screen_EPD_EXT4_Fast::s_reset()
 {
+    uint32_t chrono = micros();
+
     switch (b_family)
     {
         // case FAMILY_MEDIUM:
@@ -845,6 +1094,8 @@ void Screen_EPD_EXT4_Fast::s_reset()
 
             break;
     }
+
+    s_energyTime.reset += micros() - chrono;
 }
 
 void Screen_EPD_EXT4_Fast::s_getDataOTP()
@@ -874,10 +1125,14 @@ void Screen_EPD_EXT4_Fast::s_getDataOTP()
 
 void Screen_EPD_EXT4_Fast::s_flush(uint8_t updateMode)
 {
+    // Energy, cumulated by flushMode()
+    uint32_t chrono = micros();
+
     // Resume
     if (b_fsmPowerScreen != FSM_ON)
     {
         resume();
+        s_energyTime.powerOn += micros() - chrono;
     }
 
     switch (b_family)
@@ -908,162 +1163,565 @@ void Screen_EPD_EXT4_Fast::s_flush(uint8_t updateMode)
     {
         suspend(u_suspendScope);
     }
+
+    // Energy
+    s_energyTime.total += micros() - chrono;
 }
 
 uint8_t Screen_EPD_EXT4_Fast::flushMode(uint8_t updateMode)
 {
-    updateMode = checkTemperatureMode(updateMode);
+    if (updateMode == UPDATE_FAST)
+    {
+        s_refreshState.toggledPending = s_countToggled();
+    }
+
+    return s_flushMode(updateMode);
+}
+
+uint8_t Screen_EPD_EXT4_Fast::s_flushMode(uint8_t updateMode)
+{
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Unchanged cells, no rendering and no update
+    if (s_checkCellsChanged() == false)
+    {
+        return UPDATE_NONE;
+    }
+
+#endif // SRAM_MODE
+
+    if (updateMode == UPDATE_REGENERATE)
+    {
+        // Same temperature range as global update
+        if (checkTemperatureMode(UPDATE_GLOBAL) != UPDATE_GLOBAL)
+        {
+            updateMode = UPDATE_NONE;
+        }
+    }
+    else
+    {
+        updateMode = checkTemperatureMode(updateMode);
+    }
+
+    // Energy, all phases of one update
+    memset(&s_energyTime, 0x00, sizeof(s_energyTime));
+    b_timeBusy = 0;
 
     switch (updateMode)
     {
         case UPDATE_FAST:
-        case UPDATE_GLOBAL:
 
             s_flush(UPDATE_FAST);
+
+            s_refreshState.fastNumber += 1;
+            if (s_refreshState.toggledPending != REFRESH_TOGGLED_UNKNOWN)
+            {
+                s_refreshState.toggledTotal += s_refreshState.toggledPending;
+            }
+            break;
+
+        case UPDATE_GLOBAL:
+
+            s_flush(UPDATE_GLOBAL);
+
+            s_refreshState.fastNumber = 0;
+            s_refreshState.toggledTotal = 0;
+            s_refreshState.globalNumber += 1;
+            break;
+
+        case UPDATE_REGENERATE:
+
+            s_flushFixed(0xff); // physical black
+            s_flushFixed(0x00); // physical white
+            s_flush(UPDATE_GLOBAL);
+
+            s_refreshState.fastNumber = 0;
+            s_refreshState.toggledTotal = 0;
+            s_refreshState.globalNumber = 0;
             break;
 
         default:
 
             mySerial.println();
             mySerial.println("hV ! PDLS - UPDATE_NONE invoked");
-            break;
+            return updateMode;
     }
 
+    // Energy
+    s_energyTime.busy = b_timeBusy;
+    s_energyTime.powerOn -= hV_HAL_min(s_energyTime.powerOn, s_energyTime.reset);
+    s_energyTime.transfer = s_energyTime.total - hV_HAL_min(s_energyTime.total, s_energyTime.reset + s_energyTime.powerOn + s_energyTime.busy);
+
+    uint64_t energy = s_getEnergy(s_energyModel.reset, s_energyTime.reset);
+    energy += s_getEnergy(s_energyModel.powerOn, s_energyTime.powerOn);
+    energy += s_getEnergy(s_energyModel.transfer, s_energyTime.transfer);
+    energy += s_getEnergy(s_energyModel.busy, s_energyTime.busy);
+
+    s_energyLast = (uint32_t)energy;
+    s_energyTotal += energy;
+    s_energyNumber += 1;
+
     return updateMode;
 }
 
-void Screen_EPD_EXT4_Fast::flush()
+void Screen_EPD_EXT4_Fast::setEnergyModel(energyModel_s model)
 {
-    flushMode(UPDATE_FAST);
+    s_energyModel = model;
 }
 
-void Screen_EPD_EXT4_Fast::clear(uint16_t colour)
+energyModel_s Screen_EPD_EXT4_Fast::getEnergyModel()
+{
+    return s_energyModel;
+}
+
+energyReport_s Screen_EPD_EXT4_Fast::getEnergyReport()
+{
+    energyReport_s report;
+
+    report.time = s_energyTime;
+    report.energy = s_energyLast;
+    report.energyTotal = (uint32_t)(s_energyTotal / 1000); // uJ to mJ
+    report.flushNumber = s_energyNumber;
+
+    return report;
+}
+
+void Screen_EPD_EXT4_Fast::resetEnergyReport()
+{
+    memset(&s_energyTime, 0x00, sizeof(s_energyTime));
+    s_energyLast = 0;
+    s_energyTotal = 0;
+    s_energyNumber = 0;
+}
+
+uint64_t Screen_EPD_EXT4_Fast::s_getEnergy(uint16_t current, uint32_t time)
+{
+    // mV * uA * us = 10^-15 J = 10^-9 uJ
+    return ((uint64_t)s_energyModel.voltage * current * time) / 1000000000ULL;
+}
+
+void Screen_EPD_EXT4_Fast::flush()
 {
-    if (colour == myColours.grey)
+    s_flagFlushBusy = true;
+
+    // Pending request served by this refresh
+    if (s_flagFlushPending)
     {
-        // black = 0-1, white = 0-0
-        for (uint16_t i = 0; i < u_bufferSizeV; i++)
-        {
-            uint8_t pattern = (i % 2) ? 0b10101010 : 0b01010101;
-            for (uint16_t j = 0; j < u_bufferSizeH; j++)
-            {
-                s_newImage[i * u_bufferSizeH + j] = pattern;
-            }
-        }
+        s_flagFlushPending = false;
+        s_flushStatistics.coalesced += 1;
     }
-    else if ((colour == myColours.white) xor u_invert)
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    renderDisplayList();
+#endif // DISPLAY_LIST
+
+    s_refreshState.toggledPending = s_countToggled();
+    s_refreshState.pixels = (uint32_t)v_screenSizeV * v_screenSizeH;
+    s_refreshState.temperature = u_temperature;
+    s_refreshState.temperatureMode = checkTemperatureMode(UPDATE_FAST);
+
+    s_refreshDecision = s_refreshPolicy(s_refreshState);
+    s_refreshDecision.state = s_refreshState;
+
+    if (s_refreshDecision.mode != UPDATE_NONE)
     {
-        // physical black 0-0
-        memset(s_newImage, 0x00, u_pageColourSize);
+        // Toggled pixels already counted for the policy
+        s_flushMode(s_refreshDecision.mode);
+        s_flushStatistics.executed += 1;
+        s_flushLast = millis();
+        s_flagFlushLast = true;
     }
     else
     {
-        // physical white 1-0
-        memset(s_newImage, 0xff, u_pageColourSize);
+        s_flushStatistics.dropped += 1;
     }
+
+    s_flagFlushBusy = false;
 }
 
-void Screen_EPD_EXT4_Fast::regenerate(uint8_t mode)
+void Screen_EPD_EXT4_Fast::setRefreshPolicy(refreshPolicy_t policy)
 {
-    clear(myColours.black);
-    flush();
-    delay(100);
+    s_refreshPolicy = policy;
+}
 
-    clear(myColours.white);
-    flush();
-    delay(100);
+refreshDecision_s Screen_EPD_EXT4_Fast::getRefreshDecision()
+{
+    return s_refreshDecision;
 }
 
-void Screen_EPD_EXT4_Fast::s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
+void Screen_EPD_EXT4_Fast::setFlushInterval(uint32_t interval, uint32_t deadline)
 {
-    // Orient and check coordinates are within screen
-    if (s_orientCoordinates(x1, y1) == RESULT_ERROR)
-    {
-        return;
-    }
+    s_flushInterval = interval;
+    s_flushDeadline = deadline;
+}
 
-    // Convert combined colours into basic colours
-    bool flagOdd = ((x1 + y1) % 2 == 0);
+bool Screen_EPD_EXT4_Fast::requestFlush()
+{
+    s_flushStatistics.requested += 1;
 
-    if (colour == myColours.grey)
+    if (s_flagFlushPending)
     {
-        if (flagOdd)
-        {
-            colour = myColours.black; // black
-        }
-        else
-        {
-            colour = myColours.white; // white
-        }
+        // Latest content wins
+        s_flushStatistics.coalesced += 1;
+    }
+    else
+    {
+        s_flagFlushPending = true;
+        s_flushPendingSince = millis();
     }
 
-    // Coordinates
-    uint32_t z1 = s_getZ(x1, y1);
-    uint16_t b1 = s_getB(x1, y1);
+    return serviceFlush();
+}
 
-    // Basic colours
-    if ((colour == myColours.white) xor u_invert)
+bool Screen_EPD_EXT4_Fast::serviceFlush()
+{
+    // Nothing pending, or refresh in progress, eg. request from a callback during flush()
+    if ((s_flagFlushPending == false) or s_flagFlushBusy)
     {
-        // physical black 0-0
-        bitClear(s_newImage[z1], b1);
+        return false;
     }
-    else if ((colour == myColours.black) xor u_invert)
+
+    uint32_t now = millis();
+    bool flagInterval = (s_flagFlushLast == false) or (now - s_flushLast >= s_flushInterval);
+    bool flagDeadline = (s_flushDeadline > 0) and (now - s_flushPendingSince >= s_flushDeadline);
+
+    if (flagInterval or flagDeadline)
     {
-        // physical white 1-0
-        bitSet(s_newImage[z1], b1);
+        s_flagFlushPending = false;
+        flush();
+        return true;
     }
+
+    return false;
 }
 
-void Screen_EPD_EXT4_Fast::s_setOrientation(uint8_t orientation)
+flushStatistics_s Screen_EPD_EXT4_Fast::getFlushStatistics()
 {
-    v_orientation = orientation % 4;
+    return s_flushStatistics;
 }
 
-bool Screen_EPD_EXT4_Fast::s_orientCoordinates(uint16_t & x, uint16_t & y)
+void Screen_EPD_EXT4_Fast::resetFlushStatistics()
 {
-    bool _flagResult = RESULT_ERROR;
-    switch (v_orientation)
-    {
-        case 3: // checked, previously 1
-
-            if ((x < v_screenSizeV) and (y < v_screenSizeH))
-            {
-                x = v_screenSizeV - 1 - x;
-                _flagResult = RESULT_SUCCESS;
-            }
-            break;
+    memset(&s_flushStatistics, 0x00, sizeof(s_flushStatistics));
+}
 
-        case 2: // checked
+void Screen_EPD_EXT4_Fast::s_flushFixed(uint8_t data)
+{
+    // Energy, cumulated by flushMode()
+    uint32_t chrono = micros();
 
-            if ((x < v_screenSizeH) and (y < v_screenSizeV))
-            {
-                x = v_screenSizeH - 1 - x;
-                y = v_screenSizeV - 1 - y;
-                hV_HAL_swap(x, y);
-                _flagResult = RESULT_SUCCESS;
-            }
-            break;
+    // Resume
+    if (b_fsmPowerScreen != FSM_ON)
+    {
+        resume();
+        s_energyTime.powerOn += micros() - chrono;
+    }
 
-        case 1: // checked, previously 3
+    switch (b_family)
+    {
+        case FAMILY_SMALL:
 
-            if ((x < v_screenSizeV) and (y < v_screenSizeH))
-            {
-                y = v_screenSizeH - 1 - y;
-                _flagResult = RESULT_SUCCESS;
-            }
+            COG_SmallKP_initial(UPDATE_GLOBAL); // Initialise
+            COG_SmallKP_sendFixedData(data); // Send fixed pattern
+            COG_SmallKP_update(UPDATE_GLOBAL); // Update
+            COG_SmallKP_powerOff(); // Power off
             break;
 
-        default: // checked
+        default:
 
-            if ((x < v_screenSizeH) and (y < v_screenSizeV))
-            {
-                hV_HAL_swap(x, y);
-                _flagResult = RESULT_SUCCESS;
-            }
             break;
     }
 
-    return _flagResult;
+    // Energy
+    s_energyTime.total += micros() - chrono;
+}
+
+uint32_t Screen_EPD_EXT4_Fast::s_countToggled()
+{
+#if (SRAM_MODE == USE_INTERNAL_MCU)
+
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+    // Composition of background and overlay against previous frame
+    if (s_backgroundLength > 0)
+    {
+        return s_composeBackground(nullptr);
+    }
+#endif // BACKGROUND_MODE
+
+    uint32_t count = 0;
+    FRAMEBUFFER_TYPE nextBuffer = s_newImage;
+    FRAMEBUFFER_TYPE previousBuffer = s_newImage + u_pageColourSize;
+
+    for (uint32_t index = 0; index < u_pageColourSize; index += 1)
+    {
+        uint8_t toggled = nextBuffer[index] ^ previousBuffer[index];
+        while (toggled > 0)
+        {
+            toggled &= toggled - 1; // Clear lowest bit
+            count += 1;
+        }
+    }
+    return count;
+
+#else
+
+    return REFRESH_TOGGLED_UNKNOWN;
+
+#endif // SRAM_MODE
+}
+
+void Screen_EPD_EXT4_Fast::clear(uint16_t colour)
+{
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        displayCommand_s command = { DISPLAY_CLEAR, 0, 0, 0, { 0 }, colour, 0, 0, 0 };
+        if (s_recordCommand(command) == RESULT_SUCCESS)
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // Cached lines are overwritten, no write-back
+    for (uint8_t index = 0; index < EXTERNAL_SPI_CACHE_LINES; index += 1)
+    {
+        s_cacheTag[index] = 0xffff;
+        s_cacheAge[index] = 0;
+        s_cacheDirty[index] = false;
+    }
+
+    // Ordered dithering, same pattern as s_setPoint()
+    uint8_t level = s_getDitherLevel(colour);
+    uint8_t cells = (s_ditherMatrix == DITHER_8X8) ? 64 : 16;
+
+    if ((level == 0) or (level == cells))
+    {
+        // physical black 0-0 = white, physical white 1-0 = black
+        s_memory.fill(0, s_getDitherRow(0, level), u_pageColourSize);
+    }
+    else
+    {
+        for (uint16_t i = 0; i < u_bufferSizeV; i++)
+        {
+            s_memory.fill((uint32_t)i * u_bufferSizeH, s_getDitherRow(i, level), u_bufferSizeH);
+        }
+    }
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Spaces, grey defaults to white
+    // Logical pixels, invert applied at s_sendIndexFrame()
+    memset(s_cellNext, 0x00, s_cellNumber);
+
+    if (colour == myColours.black)
+    {
+        memset(s_attributeNext, 0xff, (s_cellNumber + 7) / 8); // Inverse
+    }
+    else
+    {
+        memset(s_attributeNext, 0x00, (s_cellNumber + 7) / 8);
+    }
+    s_cellRowChanged = ~(uint64_t)0; // All rows
+
+#else
+
+    // Ordered dithering, same pattern as s_setPoint()
+    uint8_t level = s_getDitherLevel(colour);
+    uint8_t cells = (s_ditherMatrix == DITHER_8X8) ? 64 : 16;
+
+    if ((level == 0) or (level == cells))
+    {
+        // physical black 0-0 = white, physical white 1-0 = black
+        memset(s_newImage, s_getDitherRow(0, level), u_pageColourSize);
+    }
+    else
+    {
+        for (uint16_t i = 0; i < u_bufferSizeV; i++)
+        {
+            memset(s_newImage + (uint32_t)i * u_bufferSizeH, s_getDitherRow(i, level), u_bufferSizeH);
+        }
+    }
+
+#endif // SRAM_MODE
+}
+
+void Screen_EPD_EXT4_Fast::regenerate(uint8_t mode)
+{
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Frame-buffer cleared, previous list no longer valid
+    bool oldFlagRecord = s_listFlagRecord;
+    s_listFlagRecord = false;
+    s_listFlagPrevious = false;
+#endif // DISPLAY_LIST
+
+    // Independent from the refresh policy
+    clear(myColours.black);
+    flushMode(UPDATE_FAST);
+    delay(100);
+
+    clear(myColours.white);
+    flushMode(UPDATE_FAST);
+    delay(100);
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    s_listFlagRecord = oldFlagRecord;
+#endif // DISPLAY_LIST
+}
+
+// Bayer matrix 8x8, the 4x4 matrix is the top left quarter divided by 4
+static const uint8_t ditherBayer[8][8] =
+{
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+void Screen_EPD_EXT4_Fast::s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour)
+{
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // No frame-buffer, text only
+
+#else
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Area changed only, while rasterising the display list
+    if (s_listFlagClip)
+    {
+        if ((x1 < s_listClip.x0) or (y1 < s_listClip.y0) or (x1 >= s_listClip.x0 + s_listClip.dx) or (y1 >= s_listClip.y0 + s_listClip.dy))
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
+    // Orient and check coordinates are within screen
+    if (s_orientCoordinates(x1, y1) == RESULT_ERROR)
+    {
+        return;
+    }
+
+    // Convert colours into basic colours, ordered dithering on native coordinates
+    uint8_t level = s_getDitherLevel(colour);
+    uint8_t threshold = (s_ditherMatrix == DITHER_8X8) ? ditherBayer[x1 % 8][y1 % 8] : ditherBayer[x1 % 4][y1 % 4] >> 2;
+    bool flagBlack = (threshold < level);
+
+    // Coordinates
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    FRAMEBUFFER_TYPE image = s_cacheLine(x1, true); // Line x1 only
+    uint32_t z1 = (y1 >> 3);
+
+#else
+
+    FRAMEBUFFER_TYPE image = s_newImage;
+    uint32_t z1 = s_getZ(x1, y1);
+
+#endif // SRAM_MODE
+    uint16_t b1 = s_getB(x1, y1);
+
+    // Basic colours
+    if (flagBlack xor u_invert)
+    {
+        // physical white 1-0
+        bitSet(image[z1], b1);
+    }
+    else
+    {
+        // physical black 0-0
+        bitClear(image[z1], b1);
+    }
+
+#endif // SRAM_MODE
+}
+
+void Screen_EPD_EXT4_Fast::s_setOrientation(uint8_t orientation)
+{
+    v_orientation = orientation % 4;
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    uint16_t columns = screenSizeX() / 6;
+    uint16_t rows = screenSizeY() / 8;
+
+    // Cells allocated by begin()
+    if (s_newImage != 0)
+    {
+        // New geometry, previous layout no longer valid
+        if ((columns != s_cellColumns) or (rows != s_cellRows))
+        {
+            // Spaces, no inverse
+            memset(s_cellNext, 0x00, 2 * s_cellNumber + 2 * ((s_cellNumber + 7) / 8));
+        }
+        s_cellRowChanged = ~(uint64_t)0; // All rows
+    }
+
+    s_cellColumns = columns;
+    s_cellRows = rows;
+
+    // One bit per row
+    if (s_cellRows > 64)
+    {
+        mySerial.println();
+        mySerial.println("hV ! Cells - More than 64 rows, changes shared by rows modulo 64");
+    }
+
+#endif // SRAM_MODE
+}
+
+bool Screen_EPD_EXT4_Fast::s_orientCoordinates(uint16_t & x, uint16_t & y)
+{
+    bool _flagResult = RESULT_ERROR;
+    switch (v_orientation)
+    {
+        case 3: // checked, previously 1
+
+            if ((x < v_screenSizeV) and (y < v_screenSizeH))
+            {
+                x = v_screenSizeV - 1 - x;
+                _flagResult = RESULT_SUCCESS;
+            }
+            break;
+
+        case 2: // checked
+
+            if ((x < v_screenSizeH) and (y < v_screenSizeV))
+            {
+                x = v_screenSizeH - 1 - x;
+                y = v_screenSizeV - 1 - y;
+                hV_HAL_swap(x, y);
+                _flagResult = RESULT_SUCCESS;
+            }
+            break;
+
+        case 1: // checked, previously 3
+
+            if ((x < v_screenSizeV) and (y < v_screenSizeH))
+            {
+                y = v_screenSizeH - 1 - y;
+                _flagResult = RESULT_SUCCESS;
+            }
+            break;
+
+        default: // checked
+
+            if ((x < v_screenSizeH) and (y < v_screenSizeV))
+            {
+                hV_HAL_swap(x, y);
+                _flagResult = RESULT_SUCCESS;
+            }
+            break;
+    }
+
+    return _flagResult;
 }
 
 uint32_t Screen_EPD_EXT4_Fast::s_getZ(uint16_t x1, uint16_t y1)
@@ -1103,11 +1761,1406 @@ uint16_t Screen_EPD_EXT4_Fast::s_getB(uint16_t x1, uint16_t y1)
 
 uint16_t Screen_EPD_EXT4_Fast::s_getPoint(uint16_t x1, uint16_t y1)
 {
-    return 0x0000;
+    bool flagPixel;
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Check coordinates are within screen, cells with logical coordinates
+    uint16_t x = x1;
+    uint16_t y = y1;
+    if (s_orientCoordinates(x, y) == RESULT_ERROR)
+    {
+        return myColours.white;
+    }
+
+    // Cell pixel = black, invert applied at s_sendIndexFrame()
+    flagPixel = s_getCellPixel(s_cellNext, s_attributeNext, x1, y1);
+    return flagPixel ? myColours.black : myColours.white;
+
+#else
+
+    // Orient and check coordinates are within screen
+    if (s_orientCoordinates(x1, y1) == RESULT_ERROR)
+    {
+        return myColours.white;
+    }
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    FRAMEBUFFER_TYPE image = s_cacheLine(x1, false); // Line x1 only
+    uint32_t z1 = (y1 >> 3);
+
+#else
+
+    FRAMEBUFFER_TYPE image = s_newImage;
+    uint32_t z1 = s_getZ(x1, y1);
+
+#endif // SRAM_MODE
+
+    // physical black 0-0 = white, physical white 1-0 = black
+    flagPixel = bitRead(image[z1], s_getB(x1, y1));
+    return (flagPixel xor u_invert) ? myColours.black : myColours.white;
+
+#endif // SRAM_MODE
+}
+
+uint16_t Screen_EPD_EXT4_Fast::readPixel(uint16_t x1, uint16_t y1)
+{
+    return s_getPoint(x1, y1);
 }
+
+bool Screen_EPD_EXT4_Fast::scroll(uint16_t y0, uint16_t dy, uint16_t number, uint16_t colour)
+{
+    if ((dy == 0) or (y0 + dy > screenSizeY()))
+    {
+        return RESULT_ERROR;
+    }
+    if (number > dy)
+    {
+        number = dy;
+    }
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Frame-buffer rasterised from the display list
+    if (s_listFlagRecord)
+    {
+        return RESULT_ERROR;
+    }
+#endif // DISPLAY_LIST
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // Frame-buffer not addressable
+    return RESULT_ERROR;
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Rows of cells, 8 pixels high
+    if (((y0 % 8) != 0) or ((dy % 8) != 0) or ((number % 8) != 0))
+    {
+        return RESULT_ERROR;
+    }
+
+    uint16_t first = (y0 / 8) * s_cellColumns;
+    uint16_t cells = (dy / 8) * s_cellColumns;
+    uint16_t shift = (number / 8) * s_cellColumns;
+    bool flagInverse = (colour == myColours.black); // Invert applied at s_sendIndexFrame()
+
+    // Spaces for the rows freed
+    memmove(s_cellNext + first, s_cellNext + first + shift, cells - shift);
+    memset(s_cellNext + first + cells - shift, 0x00, shift);
+
+    // Attributes, 1 bit per cell
+    for (uint16_t index = first; index < first + cells; index += 1)
+    {
+        bool flag = flagInverse;
+        if (index + shift < first + cells)
+        {
+            flag = bitRead(s_attributeNext[(index + shift) >> 3], (index + shift) % 8);
+        }
+        bitWrite(s_attributeNext[index >> 3], index % 8, flag);
+    }
+
+    for (uint16_t row = y0 / 8; row < (y0 + dy) / 8; row += 1)
+    {
+        s_cellRowChanged |= ((uint64_t)1 << (row % 64));
+    }
+
+    return RESULT_SUCCESS;
+
+#else
+
+    // Frame-buffer split in two halves
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    // physical black 0-0 = white, physical white 1-0 = black
+    uint8_t pattern = ((colour == myColours.black) xor u_invert) ? 0xff : 0x00;
+    uint16_t size = u_bufferSizeH; // bytes per line
+    uint16_t base;
+
+    switch (v_orientation)
+    {
+        case 0: // y-axis = lines, same direction
+
+            memmove(s_newImage + (uint32_t)y0 * size, s_newImage + (uint32_t)(y0 + number) * size, (uint32_t)(dy - number) * size);
+            memset(s_newImage + (uint32_t)(y0 + dy - number) * size, pattern, (uint32_t)number * size);
+            break;
+
+        case 2: // y-axis = lines, reverse direction
+
+            base = v_screenSizeV - y0 - dy;
+            memmove(s_newImage + (uint32_t)(base + number) * size, s_newImage + (uint32_t)base * size, (uint32_t)(dy - number) * size);
+            memset(s_newImage + (uint32_t)base * size, pattern, (uint32_t)number * size);
+            break;
+
+        default: // 1 and 3, y-axis = bits within each line, 3 = same direction, 1 = reverse direction
+        {
+            bool flagForward = (v_orientation == 3);
+            base = flagForward ? y0 : v_screenSizeH - y0 - dy;
+
+            for (uint16_t line = 0; line < v_screenSizeV; line += 1)
+            {
+                s_shiftBits(s_newImage + (uint32_t)line * size, base, dy, number, flagForward, pattern);
+            }
+        }
+        break;
+    }
+
+    return RESULT_SUCCESS;
+
+#endif // SRAM_MODE
+}
+
+bool Screen_EPD_EXT4_Fast::scrollLeft(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t number, uint16_t colour)
+{
+    if ((dx == 0) or (dy == 0) or (x0 + dx > screenSizeX()) or (y0 + dy > screenSizeY()))
+    {
+        return RESULT_ERROR;
+    }
+    if (number > dx)
+    {
+        number = dx;
+    }
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Frame-buffer rasterised from the display list
+    if (s_listFlagRecord)
+    {
+        return RESULT_ERROR;
+    }
+#endif // DISPLAY_LIST
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // Frame-buffer not addressable
+    return RESULT_ERROR;
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Text only
+    return RESULT_ERROR;
+
+#else
+
+    // Frame-buffer split in two halves
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    // physical black 0-0 = white, physical white 1-0 = black
+    uint8_t pattern = ((colour == myColours.black) xor u_invert) ? 0xff : 0x00;
+    uint16_t size = u_bufferSizeH; // bytes per line
+
+    switch (v_orientation)
+    {
+        case 1: // x-axis = lines, y-axis = bits in reverse direction
+        case 3: // x-axis = lines in reverse direction, y-axis = bits
+        {
+            uint16_t base = (v_orientation == 3) ? y0 : v_screenSizeH - y0 - dy;
+
+            for (uint16_t k = 0; k < dx; k += 1)
+            {
+                uint16_t line = x0 + k;
+                uint16_t other = line + number;
+                if (v_orientation == 3)
+                {
+                    line = v_screenSizeV - 1 - line;
+                    other = v_screenSizeV - 1 - other;
+                }
+
+                const uint8_t * source = (k + number < dx) ? s_newImage + (uint32_t)other * size : nullptr;
+                s_copyBits(s_newImage + (uint32_t)line * size, source, base, dy, pattern);
+            }
+        }
+        break;
+
+        default: // 0 and 2, y-axis = lines, x-axis = bits within each line, 0 = same direction, 2 = reverse direction
+        {
+            bool flagForward = (v_orientation == 0);
+            uint16_t base = flagForward ? x0 : v_screenSizeH - x0 - dx;
+            uint16_t first = flagForward ? y0 : v_screenSizeV - y0 - dy;
+
+            for (uint16_t line = first; line < first + dy; line += 1)
+            {
+                s_shiftBits(s_newImage + (uint32_t)line * size, base, dx, number, flagForward, pattern);
+            }
+        }
+        break;
+    }
+
+    return RESULT_SUCCESS;
+
+#endif // SRAM_MODE
+}
+
+bool Screen_EPD_EXT4_Fast::rotate(uint8_t orientation, uint16_t colour)
+{
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Frame-buffer rasterised from the display list
+    if (s_listFlagRecord)
+    {
+        return RESULT_ERROR;
+    }
+#endif // DISPLAY_LIST
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // Frame-buffer not addressable
+    return RESULT_ERROR;
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Text only
+    return RESULT_ERROR;
+
+#else
+
+    // Frame-buffer split in two halves
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    uint8_t oldOrientation = v_orientation;
+    setOrientation(orientation);
+    uint8_t turn = (v_orientation + 4 - oldOrientation) % 4;
+
+    // physical black 0-0 = white, physical white 1-0 = black
+    uint8_t pattern = ((colour == myColours.black) xor u_invert) ? 0xff : 0x00;
+    uint16_t size = u_bufferSizeH; // bytes per line
+
+    switch (turn)
+    {
+        case 2: // 180°, lines in reverse order, bits in reverse order
+        {
+            uint32_t first = 0;
+            uint32_t last = u_pageColourSize - 1;
+            while (first < last)
+            {
+                uint8_t value = s_reverseBits(s_newImage[first]);
+                s_newImage[first] = s_reverseBits(s_newImage[last]);
+                s_newImage[last] = value;
+                first += 1;
+                last -= 1;
+            }
+        }
+        break;
+
+        case 1: // 90°
+        case 3: // 270°
+        {
+            // Square at the top left corner, v_screenSizeH lines
+            // Orientations 0 and 1 = first lines, 2 and 3 = last lines
+            uint32_t square = (uint32_t)v_screenSizeH * size;
+            uint32_t oldBase = (oldOrientation < 2) ? 0 : u_pageColourSize - square;
+            uint32_t newBase = (v_orientation < 2) ? 0 : u_pageColourSize - square;
+
+            if (oldBase != newBase)
+            {
+                memmove(s_newImage + newBase, s_newImage + oldBase, square);
+            }
+            memset(s_newImage, pattern, newBase);
+            memset(s_newImage + newBase + square, pattern, u_pageColourSize - newBase - square);
+
+            uint8_t * image = s_newImage + newBase;
+            s_transposeBits(image, size);
+
+            if (turn == 1)
+            {
+                // Bits in reverse order within each line
+                for (uint16_t line = 0; line < v_screenSizeH; line += 1)
+                {
+                    uint8_t * first = image + (uint32_t)line * size;
+                    uint8_t * last = first + size - 1;
+                    while (first < last)
+                    {
+                        uint8_t value = s_reverseBits(*first);
+                        *first = s_reverseBits(*last);
+                        *last = value;
+                        first += 1;
+                        last -= 1;
+                    }
+                    if (first == last)
+                    {
+                        *first = s_reverseBits(*first);
+                    }
+                }
+            }
+            else
+            {
+                // Lines in reverse order
+                for (uint16_t line = 0; line < v_screenSizeH / 2; line += 1)
+                {
+                    uint8_t * first = image + (uint32_t)line * size;
+                    uint8_t * last = image + (uint32_t)(v_screenSizeH - 1 - line) * size;
+                    for (uint16_t index = 0; index < size; index += 1)
+                    {
+                        hV_HAL_swap(first[index], last[index]);
+                    }
+                }
+            }
+        }
+        break;
+
+        default: // Same orientation
+
+            break;
+    }
+
+    return RESULT_SUCCESS;
+
+#endif // SRAM_MODE
+}
+
+bool Screen_EPD_EXT4_Fast::floodFill(uint16_t x0, uint16_t y0, uint16_t colour)
+{
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Frame-buffer rasterised from the display list
+    if (s_listFlagRecord)
+    {
+        return RESULT_ERROR;
+    }
+#endif // DISPLAY_LIST
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // Frame-buffer not addressable
+    return RESULT_ERROR;
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Text only
+    return RESULT_ERROR;
+
+#else
+
+    // Frame-buffer split in two halves
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        return RESULT_ERROR;
+    }
+
+    // Basic colours only
+    if ((colour != myColours.black) and (colour != myColours.white))
+    {
+        return RESULT_ERROR;
+    }
+
+    // Native coordinates, x0 = line, y0 = bit within the line
+    if (s_orientCoordinates(x0, y0) == RESULT_ERROR)
+    {
+        return RESULT_ERROR;
+    }
+
+    // physical black 0-0 = white, physical white 1-0 = black
+    uint16_t size = u_bufferSizeH; // bytes per line
+    bool flagFill = ((colour == myColours.black) xor u_invert);
+    bool flagTarget = bitRead(s_newImage[(uint32_t)x0 * size + (y0 >> 3)], 7 - (y0 % 8));
+    uint8_t pattern = flagFill ? 0xff : 0x00;
+
+    // Already filled
+    if (flagTarget == flagFill)
+    {
+        return RESULT_SUCCESS;
+    }
+
+    // Seeds pending, bounded
+    uint16_t stackLine[FLOOD_FILL_STACK];
+    uint16_t stackBit[FLOOD_FILL_STACK];
+    uint16_t count = 0;
+    bool flagResult = RESULT_SUCCESS;
+
+    stackLine[count] = x0;
+    stackBit[count] = y0;
+    count += 1;
+
+    while (count > 0)
+    {
+        count -= 1;
+        uint16_t line = stackLine[count];
+        uint16_t bit = stackBit[count];
+        uint8_t * image = s_newImage + (uint32_t)line * size;
+
+        // Already filled from another seed
+        if (bitRead(image[bit >> 3], 7 - (bit % 8)) != flagTarget)
+        {
+            continue;
+        }
+
+        // Span around the seed, last bit excluded
+        uint16_t first = s_scanBits(image, bit, 0, flagTarget, false);
+        uint16_t last = s_scanBits(image, bit, v_screenSizeH, flagTarget, true);
+        s_copyBits(image, nullptr, first, last - first, pattern);
+
+        // One seed per run on the lines before and after, within the span
+        for (uint8_t side = 0; side < 2; side += 1)
+        {
+            if (((side == 0) and (line == 0)) or ((side == 1) and (line + 1 >= v_screenSizeV)))
+            {
+                continue;
+            }
+
+            uint16_t other = (side == 0) ? line - 1 : line + 1;
+            const uint8_t * neighbour = s_newImage + (uint32_t)other * size;
+            uint16_t next = s_scanBits(neighbour, first, last, not flagTarget, true);
+
+            while (next < last)
+            {
+                if (count < FLOOD_FILL_STACK)
+                {
+                    stackLine[count] = other;
+                    stackBit[count] = next;
+                    count += 1;
+                }
+                else
+                {
+                    flagResult = RESULT_ERROR;
+                }
+
+                next = s_scanBits(neighbour, next, last, flagTarget, true);
+                next = s_scanBits(neighbour, next, last, not flagTarget, true);
+            }
+        }
+    }
+
+    if (flagResult == RESULT_ERROR)
+    {
+        mySerial.println("hV ! Flood fill stack full");
+    }
+    return flagResult;
+
+#endif // SRAM_MODE
+}
+
+void Screen_EPD_EXT4_Fast::s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // No frame-buffer, text only
+
+#else
+
+    // Frame-buffer split in two halves
+    if ((u_codeSize == SIZE_969) or (u_codeSize == SIZE_1198))
+    {
+        hV_Screen_Buffer::s_setArea(x1, y1, x2, y2, colour);
+        return;
+    }
+
+    // Clip to the screen
+    x2 = hV_HAL_min(x2, (uint16_t)(screenSizeX() - 1));
+    y2 = hV_HAL_min(y2, (uint16_t)(screenSizeY() - 1));
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Area changed only, while rasterising the display list
+    if (s_listFlagClip)
+    {
+        x1 = hV_HAL_max(x1, s_listClip.x0);
+        y1 = hV_HAL_max(y1, s_listClip.y0);
+        x2 = hV_HAL_min(x2, (uint16_t)(s_listClip.x0 + s_listClip.dx - 1));
+        y2 = hV_HAL_min(y2, (uint16_t)(s_listClip.y0 + s_listClip.dy - 1));
+    }
+#endif // DISPLAY_LIST
+
+    if ((x1 > x2) or (y1 > y2))
+    {
+        return;
+    }
+
+    // Native coordinates, lines and bits within each line
+    s_orientCoordinates(x1, y1);
+    s_orientCoordinates(x2, y2);
+    uint16_t firstLine = hV_HAL_min(x1, x2);
+    uint16_t lastLine = hV_HAL_max(x1, x2);
+    uint16_t firstBit = hV_HAL_min(y1, y2);
+    uint16_t bits = hV_HAL_max(y1, y2) - firstBit + 1;
+
+    // One pattern byte per line, span filled by bytes
+    uint8_t level = s_getDitherLevel(colour);
+    for (uint16_t line = firstLine; line <= lastLine; line += 1)
+    {
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+        uint8_t * image = s_cacheLine(line, true); // Line only
+
+#else
+
+        uint8_t * image = s_newImage + (uint32_t)line * u_bufferSizeH;
+
+#endif // SRAM_MODE
+
+        s_copyBits(image, nullptr, firstBit, bits, s_getDitherRow(line, level));
+    }
+
+#endif // SRAM_MODE
+}
+
+void Screen_EPD_EXT4_Fast::setDither(uint8_t matrix)
+{
+    s_ditherMatrix = (matrix == DITHER_8X8) ? DITHER_8X8 : DITHER_4X4;
+
+    // Level of last colour computed again
+    s_ditherColour = myColours.white;
+    s_ditherLevel = 0;
+}
+
+uint8_t Screen_EPD_EXT4_Fast::s_getDitherLevel(uint16_t colour)
+{
+    if (colour != s_ditherColour)
+    {
+        uint8_t cells = (s_ditherMatrix == DITHER_8X8) ? 64 : 16;
+
+        if (colour == myColours.grey)
+        {
+            // Checkerboard
+            s_ditherLevel = cells / 2;
+        }
+        else
+        {
+            // Components on 8 bits, then luminance with weights 77, 150 and 29 out of 256
+            uint32_t red = (colour >> 11) & 0x1f;
+            uint32_t green = (colour >> 5) & 0x3f;
+            uint32_t blue = colour & 0x1f;
+            red = (red << 3) | (red >> 2);
+            green = (green << 2) | (green >> 4);
+            blue = (blue << 3) | (blue >> 2);
+            uint32_t luminance = (77 * red + 150 * green + 29 * blue) >> 8;
+
+            s_ditherLevel = ((255 - luminance) * cells + 127) / 255;
+        }
+        s_ditherColour = colour;
+    }
+
+    return s_ditherLevel;
+}
+
+uint8_t Screen_EPD_EXT4_Fast::s_getDitherRow(uint16_t line, uint8_t level)
+{
+    uint8_t result = 0x00;
+
+    for (uint8_t k = 0; k < 8; k += 1)
+    {
+        uint8_t threshold = (s_ditherMatrix == DITHER_8X8) ? ditherBayer[line % 8][k] : ditherBayer[line % 4][k % 4] >> 2;
+        if (threshold < level)
+        {
+            result |= 0x80 >> k; // as s_getB()
+        }
+    }
+
+    // physical black 0-0 = white, physical white 1-0 = black
+    return u_invert ? ~result : result;
+}
+
+void Screen_EPD_EXT4_Fast::s_shiftBits(uint8_t * image, uint16_t base, uint16_t size, uint16_t number, bool flagForward, uint8_t pattern)
+{
+    if (((base % 8) == 0) and ((size % 8) == 0) and ((number % 8) == 0))
+    {
+        // Whole bytes
+        uint16_t first = base / 8;
+        uint16_t bytes = size / 8;
+        uint16_t shift = number / 8;
+
+        if (flagForward)
+        {
+            memmove(image + first, image + first + shift, bytes - shift);
+            memset(image + first + bytes - shift, pattern, shift);
+        }
+        else
+        {
+            memmove(image + first + shift, image + first, bytes - shift);
+            memset(image + first, pattern, shift);
+        }
+    }
+    else
+    {
+        // Bits, in copy order, as s_getB()
+        for (uint16_t k = 0; k < size; k += 1)
+        {
+            uint16_t p = flagForward ? base + k : base + size - 1 - k;
+            bool flag = (pattern != 0x00);
+            if (k + number < size)
+            {
+                uint16_t q = flagForward ? p + number : p - number;
+                flag = bitRead(image[q >> 3], 7 - (q % 8));
+            }
+            bitWrite(image[p >> 3], 7 - (p % 8), flag);
+        }
+    }
+}
+
+void Screen_EPD_EXT4_Fast::s_copyBits(uint8_t * destination, const uint8_t * source, uint16_t base, uint16_t size, uint8_t pattern)
+{
+    uint16_t first = base >> 3;
+    uint16_t last = (base + size - 1) >> 3;
+
+    for (uint16_t index = first; index <= last; index += 1)
+    {
+        // Bits of the byte within the range, as s_getB()
+        uint8_t mask = 0xff;
+        if (index == first)
+        {
+            mask &= 0xff >> (base % 8);
+        }
+        if (index == last)
+        {
+            mask &= 0xff << (7 - ((base + size - 1) % 8));
+        }
+
+        uint8_t value = (source != nullptr) ? source[index] : pattern;
+        destination[index] = (destination[index] & ~mask) | (value & mask);
+    }
+}
+
+void Screen_EPD_EXT4_Fast::s_transposeBits(uint8_t * image, uint16_t size)
+{
+    uint64_t block[2];
+
+    for (uint16_t i = 0; i < size; i += 1)
+    {
+        for (uint16_t j = i; j < size; j += 1)
+        {
+            // Blocks (i, j) and (j, i), 8 lines of 1 byte each, first line as MSB
+            block[0] = 0;
+            block[1] = 0;
+            for (uint8_t k = 0; k < 8; k += 1)
+            {
+                block[0] = (block[0] << 8) | image[(uint32_t)(8 * i + k) * size + j];
+                block[1] = (block[1] << 8) | image[(uint32_t)(8 * j + k) * size + i];
+            }
+
+            // Transpose 8x8 bits, Hacker's Delight
+            for (uint8_t b = 0; b < 2; b += 1)
+            {
+                uint64_t x = block[b];
+                uint64_t t;
+                t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL;
+                x = x ^ t ^ (t << 7);
+                t = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL;
+                x = x ^ t ^ (t << 14);
+                t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL;
+                block[b] = x ^ t ^ (t << 28);
+            }
+
+            // Swapped, last line as LSB
+            for (uint8_t k = 8; k > 0; k -= 1)
+            {
+                image[(uint32_t)(8 * j + k - 1) * size + i] = block[0];
+                image[(uint32_t)(8 * i + k - 1) * size + j] = block[1];
+                block[0] >>= 8;
+                block[1] >>= 8;
+            }
+        }
+    }
+}
+
+uint8_t Screen_EPD_EXT4_Fast::s_reverseBits(uint8_t value)
+{
+    value = (value >> 4) | (value << 4);
+    value = ((value & 0xcc) >> 2) | ((value & 0x33) << 2);
+    value = ((value & 0xaa) >> 1) | ((value & 0x55) << 1);
+    return value;
+}
+
+uint16_t Screen_EPD_EXT4_Fast::s_scanBits(const uint8_t * image, uint16_t bit, uint16_t limit, bool flagValue, bool flagForward)
+{
+    uint8_t skip = flagValue ? 0xff : 0x00; // whole byte with value
+    uint16_t p = bit;
+
+    if (flagForward)
+    {
+        while (p < limit)
+        {
+            if (((p % 8) == 0) and (p + 8 <= limit) and (image[p >> 3] == skip))
+            {
+                p += 8;
+            }
+            else if (bitRead(image[p >> 3], 7 - (p % 8)) == flagValue)
+            {
+                p += 1;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        while (p > limit)
+        {
+            if (((p % 8) == 0) and (p >= limit + 8) and (image[(p >> 3) - 1] == skip))
+            {
+                p -= 8;
+            }
+            else if (bitRead(image[(p - 1) >> 3], 7 - ((p - 1) % 8)) == flagValue)
+            {
+                p -= 1;
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    return p;
+}
+
+void Screen_EPD_EXT4_Fast::s_sendIndexFrame(uint8_t index, uint32_t offset)
+{
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+
+    // Stream from external memory to panel, by blocks of the cache size
+    // Cache emptied by s_cacheFlush() before
+    uint32_t blockSize = (uint32_t)EXTERNAL_SPI_CACHE_LINES * u_bufferSizeH;
+
+    b_sendIndexOnly(index);
+    for (uint32_t address = 0; address < u_pageColourSize; address += blockSize)
+    {
+        uint32_t size = hV_HAL_min(blockSize, u_pageColourSize - address);
+
+        s_memory.read(offset + address, s_newImage, size);
+        b_sendDataBlock(s_newImage, size);
+
+        if (offset == 0) // Copy next frame to previous frame
+        {
+            s_memory.write(u_pageColourSize + address, s_newImage, size);
+        }
+    }
+
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+
+    // Render the cells line by line, native coordinates, reverse of s_orientCoordinates()
+    // * Orientations 1 and 3: native line = one glyph column, one byte per cell
+    // * Orientations 0 and 2: native line = one glyph row, one bit per glyph column
+    const uint8_t * cells = (offset == 0) ? s_cellNext : s_cellPrevious;
+    const uint8_t * attributes = (offset == 0) ? s_attributeNext : s_attributePrevious;
+    uint8_t lastMask = (v_screenSizeH % 8) ? (0xff << (8 - v_screenSizeH % 8)) : 0xff;
+
+    b_sendIndexOnly(index);
+    for (uint16_t x1 = 0; x1 < u_bufferSizeV; x1 += 1)
+    {
+        memset(s_newImage, 0x00, u_bufferSizeH);
+
+        if (v_orientation % 2) // 1 or 3
+        {
+            // Logical column x, same glyph column for all the cells
+            uint16_t x = (v_orientation == 3) ? v_screenSizeV - 1 - x1 : x1;
+            uint16_t column = x / 6;
+            uint8_t k = x % 6;
+
+            if (column < s_cellColumns)
+            {
+                uint16_t cell = column;
+                for (uint16_t row = 0; row < s_cellRows; row += 1)
+                {
+                    // Glyph column, logical y = 8 * row + bit
+                    uint8_t value = Terminal6x8e[f_getCharacterRow(cells[cell])][k];
+                    if (bitRead(attributes[cell >> 3], cell % 8))
+                    {
+                        value = ~value;
+                    }
+
+                    if (v_orientation == 3) // y1 = y
+                    {
+                        s_orBits(s_newImage, 8 * row, s_reverseBits(value));
+                    }
+                    else // y1 = v_screenSizeH - 1 - y
+                    {
+                        s_orBits(s_newImage, v_screenSizeH - 8 - 8 * row, value);
+                    }
+                    cell += s_cellColumns;
+                }
+            }
+        }
+        else // 0 or 2
+        {
+            // Logical row y, same glyph row for all the cells
+            uint16_t y = (v_orientation == 2) ? v_screenSizeV - 1 - x1 : x1;
+            uint16_t row = y / 8;
+            uint8_t bit = y % 8;
+
+            if (row < s_cellRows)
+            {
+                uint16_t cell = row * s_cellColumns;
+                for (uint16_t column = 0; column < s_cellColumns; column += 1)
+                {
+                    // Glyph row, logical x = 6 * column + k as MSB first
+                    const uint8_t * glyph = Terminal6x8e[f_getCharacterRow(cells[cell])];
+                    uint8_t value = 0;
+                    for (uint8_t k = 0; k < 6; k += 1)
+                    {
+                        value |= ((glyph[k] >> bit) & 0x01) << (7 - k);
+                    }
+                    if (bitRead(attributes[cell >> 3], cell % 8))
+                    {
+                        value ^= 0xfc;
+                    }
+
+                    if (v_orientation == 2) // y1 = v_screenSizeH - 1 - x
+                    {
+                        s_orBits(s_newImage, v_screenSizeH - 6 - 6 * column, s_reverseBits(value) << 2);
+                    }
+                    else // y1 = x
+                    {
+                        s_orBits(s_newImage, 6 * column, value);
+                    }
+                    cell += 1;
+                }
+            }
+        }
+
+        // Physical white 1-0, bits past the line unchanged
+        if (u_invert)
+        {
+            for (uint16_t i = 0; i < u_bufferSizeH; i += 1)
+            {
+                s_newImage[i] = ~s_newImage[i];
+            }
+            s_newImage[u_bufferSizeH - 1] &= lastMask;
+        }
+
+        b_sendDataBlock(s_newImage, u_bufferSizeH);
+    }
+
+#else
+
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+    // Next frame composed into previous frame, already sent or not required
+    if ((offset == 0) and (s_backgroundLength > 0))
+    {
+        s_composeBackground(s_newImage + u_pageColourSize);
+        offset = u_pageColourSize;
+    }
+#endif // BACKGROUND_MODE
+
+    b_sendIndexData(index, s_newImage + offset, u_pageColourSize);
+
+#endif // SRAM_MODE
+}
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+//
+// === External SPI memory section
+//
+uint8_t * Screen_EPD_EXT4_Fast::s_cacheLine(uint16_t line, bool flagWrite)
+{
+    uint8_t victim = 0;
+    s_cacheClock += 1;
+
+    for (uint8_t index = 0; index < EXTERNAL_SPI_CACHE_LINES; index += 1)
+    {
+        // Hit
+        if (s_cacheTag[index] == line)
+        {
+            s_cacheAge[index] = s_cacheClock;
+            s_cacheDirty[index] |= flagWrite;
+            return s_newImage + (uint32_t)index * u_bufferSizeH;
+        }
+
+        // Least recently used, empty lines first
+        if (s_cacheAge[index] < s_cacheAge[victim])
+        {
+            victim = index;
+        }
+    }
+
+    // Miss
+    uint8_t * buffer = s_newImage + (uint32_t)victim * u_bufferSizeH;
+    if (s_cacheDirty[victim])
+    {
+        s_memory.write((uint32_t)s_cacheTag[victim] * u_bufferSizeH, buffer, u_bufferSizeH);
+    }
+    s_memory.read((uint32_t)line * u_bufferSizeH, buffer, u_bufferSizeH);
+
+    s_cacheTag[victim] = line;
+    s_cacheAge[victim] = s_cacheClock;
+    s_cacheDirty[victim] = flagWrite;
+    return buffer;
+}
+
+void Screen_EPD_EXT4_Fast::s_cacheFlush()
+{
+    for (uint8_t index = 0; index < EXTERNAL_SPI_CACHE_LINES; index += 1)
+    {
+        if (s_cacheDirty[index])
+        {
+            s_memory.write((uint32_t)s_cacheTag[index] * u_bufferSizeH, s_newImage + (uint32_t)index * u_bufferSizeH, u_bufferSizeH);
+        }
+        s_cacheTag[index] = 0xffff;
+        s_cacheAge[index] = 0;
+        s_cacheDirty[index] = false;
+    }
+}
+//
+// === End of External SPI memory section
+//
+#endif // SRAM_MODE
+//
+// === End of Class section
+//
+
+//
+// === Refresh section
+//
+refreshDecision_s refreshPolicyFast(refreshState_s state)
+{
+    refreshDecision_s decision;
+    decision.mode = UPDATE_FAST;
+    decision.reason = REFRESH_REASON_DEFAULT;
+    decision.state = state;
+    return decision;
+}
+
+refreshDecision_s refreshPolicyCounter(refreshState_s state)
+{
+    refreshDecision_s decision = refreshPolicyFast(state);
+
+    if (state.fastNumber >= REFRESH_FAST_LIMIT)
+    {
+        decision.mode = UPDATE_GLOBAL;
+        decision.reason = REFRESH_REASON_COUNTER;
+    }
+    return decision;
+}
+
+refreshDecision_s refreshPolicyAdaptive(refreshState_s state)
+{
+    refreshDecision_s decision = refreshPolicyFast(state);
+
+    if (state.toggledPending == 0)
+    {
+        decision.mode = UPDATE_NONE;
+        decision.reason = REFRESH_REASON_UNCHANGED;
+        return decision;
+    }
+
+    if (state.temperatureMode != UPDATE_FAST)
+    {
+        decision.mode = UPDATE_GLOBAL;
+        decision.reason = REFRESH_REASON_TEMPERATURE;
+    }
+    else if (state.fastNumber >= REFRESH_FAST_LIMIT_ADAPTIVE)
+    {
+        decision.mode = UPDATE_GLOBAL;
+        decision.reason = REFRESH_REASON_COUNTER;
+    }
+    else if ((state.toggledPending != REFRESH_TOGGLED_UNKNOWN) and (state.pixels > 0)
+             and ((uint64_t)(state.toggledTotal + state.toggledPending) * 100 >= (uint64_t)state.pixels * REFRESH_TOGGLED_LIMIT))
+    {
+        decision.mode = UPDATE_GLOBAL;
+        decision.reason = REFRESH_REASON_TOGGLED;
+    }
+
+    // Regenerate only when global update is possible
+    if ((decision.mode == UPDATE_GLOBAL) and (state.temperatureMode != UPDATE_NONE) and (state.globalNumber + 1 >= REFRESH_GLOBAL_LIMIT))
+    {
+        decision.mode = UPDATE_REGENERATE;
+        decision.reason = REFRESH_REASON_GLOBAL;
+    }
+
+    return decision;
+}
+//
+// === End of Refresh section
+//
+
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+//
+// === Background section
+//
+// Difference with the line before, then run-length encoding, see frameEncode()
+//
+bool Screen_EPD_EXT4_Fast::saveBackground(uint8_t mode)
+{
+    s_backgroundMode = mode;
+
+    if (s_backgroundLine == nullptr)
+    {
+        s_backgroundLine = new uint8_t[u_bufferSizeH];
+    }
+
+    s_backgroundLength = frameEncode(s_newImage, u_pageColourSize, u_bufferSizeH, s_backgroundData, BACKGROUND_SIZE);
+    if (s_backgroundLength == 0)
+    {
+        mySerial.println("hV ! Background too large");
+        return RESULT_ERROR;
+    }
+
+    return RESULT_SUCCESS;
+}
+
+void Screen_EPD_EXT4_Fast::clearBackground()
+{
+    s_backgroundLength = 0;
+}
+
+uint16_t Screen_EPD_EXT4_Fast::getBackgroundSize()
+{
+    return s_backgroundLength;
+}
+
+uint32_t Screen_EPD_EXT4_Fast::s_composeBackground(FRAMEBUFFER_TYPE destination)
+{
+    FRAMEBUFFER_TYPE nextBuffer = s_newImage;
+    FRAMEBUFFER_TYPE previousBuffer = s_newImage + u_pageColourSize;
+
+    // Black is 1, unless inverted
+    bool flagOr = ((s_backgroundMode == BACKGROUND_OR) xor u_invert);
+
+    uint32_t count = 0;
+    uint16_t position = 0; // byte of the background
+    uint8_t remaining = 0; // bytes left in the current run or literal
+    bool flagRun = false;
+    uint8_t value = 0;
+
+    memset(s_backgroundLine, 0x00, u_bufferSizeH);
+
+    for (uint16_t line = 0; line < u_bufferSizeV; line += 1)
+    {
+        // Background of the line, from the difference with the line before
+        uint16_t k = 0;
+        while (k < u_bufferSizeH)
+        {
+            if (remaining == 0)
+            {
+                if (position >= s_backgroundLength)
+                {
+                    break; // Truncated, rest unchanged
+                }
+                uint8_t control = s_backgroundData[position];
+                remaining = (control & 0x7f) + 1;
+                flagRun = (control & 0x80);
+                position += 1;
+                if (flagRun)
+                {
+                    value = s_backgroundData[position];
+                    position += 1;
+                }
+            }
+
+            uint8_t number = hV_HAL_min(remaining, u_bufferSizeH - k);
+            if (flagRun)
+            {
+                if (value != 0x00)
+                {
+                    for (uint8_t j = 0; j < number; j += 1)
+                    {
+                        s_backgroundLine[k + j] ^= value;
+                    }
+                }
+            }
+            else
+            {
+                for (uint8_t j = 0; j < number; j += 1)
+                {
+                    s_backgroundLine[k + j] ^= s_backgroundData[position + j];
+                }
+                position += number;
+            }
+            k += number;
+            remaining -= number;
+        }
+
+        // Composition with 32-bit words, memcpy() for any alignment
+        uint32_t offset = (uint32_t)line * u_bufferSizeH;
+        uint32_t word, background, previous;
+        k = 0;
+        for (; k + 4 <= u_bufferSizeH; k += 4)
+        {
+            memcpy(&word, nextBuffer + offset + k, 4);
+            memcpy(&background, s_backgroundLine + k, 4);
+            word = flagOr ? (word | background) : (word & background);
+
+            if (destination != nullptr)
+            {
+                memcpy(destination + offset + k, &word, 4);
+            }
+            else
+            {
+                memcpy(&previous, previousBuffer + offset + k, 4);
+                word ^= previous;
+                while (word > 0)
+                {
+                    word &= word - 1; // Clear lowest bit
+                    count += 1;
+                }
+            }
+        }
+
+        // Remaining bytes
+        for (; k < u_bufferSizeH; k += 1)
+        {
+            uint8_t result = flagOr ? (nextBuffer[offset + k] | s_backgroundLine[k]) : (nextBuffer[offset + k] & s_backgroundLine[k]);
+
+            if (destination != nullptr)
+            {
+                destination[offset + k] = result;
+            }
+            else
+            {
+                result ^= previousBuffer[offset + k];
+                while (result > 0)
+                {
+                    result &= result - 1; // Clear lowest bit
+                    count += 1;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+//
+// === End of Background section
+//
+#endif // BACKGROUND_MODE
+
+#if (PAGE_CACHE == USE_PAGE_CACHE_YES)
+//
+// === Page cache section
+//
+// Pages packed in s_pageData in order of index, see frameEncode() for the format
+//
+bool Screen_EPD_EXT4_Fast::savePage(uint8_t page, uint16_t version)
+{
+    // Previous version of the same page
+    for (uint8_t index = 0; index < s_pageCount; index += 1)
+    {
+        if (s_pageNumber[index] == page)
+        {
+            s_removePage(index);
+            break;
+        }
+    }
+
+    uint32_t length = frameEncode(s_newImage, u_pageColourSize, u_bufferSizeH, nullptr, PAGE_CACHE_SIZE);
+    if (length > PAGE_CACHE_SIZE)
+    {
+        mySerial.println("hV ! Page too large");
+        return RESULT_ERROR;
+    }
+
+    // Least recently used pages removed
+    while ((s_pageCount >= PAGE_CACHE_PAGES) or (s_pageBytes + length > PAGE_CACHE_SIZE))
+    {
+        uint8_t victim = 0;
+        for (uint8_t index = 1; index < s_pageCount; index += 1)
+        {
+            if (s_pageUse[index] < s_pageUse[victim])
+            {
+                victim = index;
+            }
+        }
+        s_removePage(victim);
+        s_pageStatistics.evictions += 1;
+    }
+
+    frameEncode(s_newImage, u_pageColourSize, u_bufferSizeH, s_pageData + s_pageBytes, PAGE_CACHE_SIZE - s_pageBytes);
+
+    s_pageClock += 1;
+    s_pageNumber[s_pageCount] = page;
+    s_pageVersion[s_pageCount] = version;
+    s_pageLength[s_pageCount] = length;
+    s_pageUse[s_pageCount] = s_pageClock;
+    s_pageCount += 1;
+    s_pageBytes += length;
+
+    return RESULT_SUCCESS;
+}
+
+bool Screen_EPD_EXT4_Fast::loadPage(uint8_t page, uint16_t version)
+{
+    uint16_t offset = 0;
+
+    for (uint8_t index = 0; index < s_pageCount; index += 1)
+    {
+        if (s_pageNumber[index] == page)
+        {
+            if (s_pageVersion[index] != version)
+            {
+                // Obsolete version
+                s_removePage(index);
+                break;
+            }
+
+            frameDecode(s_pageData + offset, s_pageLength[index], s_newImage, u_pageColourSize, u_bufferSizeH);
+
+            s_pageClock += 1;
+            s_pageUse[index] = s_pageClock;
+            s_pageStatistics.hits += 1;
+            return RESULT_SUCCESS;
+        }
+        offset += s_pageLength[index];
+    }
+
+    s_pageStatistics.misses += 1;
+    return RESULT_ERROR;
+}
+
+void Screen_EPD_EXT4_Fast::clearPageCache()
+{
+    s_pageCount = 0;
+    s_pageBytes = 0;
+}
+
+pageCacheStatistics_s Screen_EPD_EXT4_Fast::getPageCacheStatistics()
+{
+    s_pageStatistics.bytes = s_pageBytes;
+    s_pageStatistics.pages = s_pageCount;
+    return s_pageStatistics;
+}
+
+void Screen_EPD_EXT4_Fast::resetPageCacheStatistics()
+{
+    s_pageStatistics.hits = 0;
+    s_pageStatistics.misses = 0;
+    s_pageStatistics.evictions = 0;
+}
+
+void Screen_EPD_EXT4_Fast::s_removePage(uint8_t index)
+{
+    uint16_t offset = 0;
+    for (uint8_t i = 0; i < index; i += 1)
+    {
+        offset += s_pageLength[i];
+    }
+    uint16_t length = s_pageLength[index];
+
+    // Following pages moved down
+    memmove(s_pageData + offset, s_pageData + offset + length, s_pageBytes - offset - length);
+    for (uint8_t i = index; i + 1 < s_pageCount; i += 1)
+    {
+        s_pageNumber[i] = s_pageNumber[i + 1];
+        s_pageVersion[i] = s_pageVersion[i + 1];
+        s_pageLength[i] = s_pageLength[i + 1];
+        s_pageUse[i] = s_pageUse[i + 1];
+    }
+
+    s_pageCount -= 1;
+    s_pageBytes -= length;
+}
+//
+// === End of Page cache section
+//
+#endif // PAGE_CACHE
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+//
+// === Character cells section
+//
+uint16_t Screen_EPD_EXT4_Fast::s_drawText(uint16_t x0, uint16_t y0,
+                                          const char * text, uint16_t length,
+                                          uint16_t textColour, uint16_t backColour,
+                                          uint8_t scale)
+{
+    uint16_t column = x0 / 6;
+    uint16_t row = y0 / 8;
+
+    if (row >= s_cellRows)
+    {
+        return 0;
+    }
+
+    bool flagInverse = ((textColour == myColours.white) and (backColour == myColours.black));
+
+    uint16_t position = 0; // byte
+    uint16_t k = 0; // cell
+    for (k = 0; position < length; k += 1)
+    {
+        if (column + k >= s_cellColumns)
+        {
+            break;
+        }
+
+        uint16_t index = row * s_cellColumns + column + k;
+        s_cellNext[index] = f_getGlyph(utf8CodePoint(text, length, position)) - ' ';
+
+        if (flagInverse)
+        {
+            bitSet(s_attributeNext[index >> 3], index % 8);
+        }
+        else
+        {
+            bitClear(s_attributeNext[index >> 3], index % 8);
+        }
+    }
+
+    s_cellRowChanged |= ((uint64_t)1 << (row % 64));
+
+    return k * 6;
+}
+
+uint16_t Screen_EPD_EXT4_Fast::cellNumberX()
+{
+    return s_cellColumns;
+}
+
+uint16_t Screen_EPD_EXT4_Fast::cellNumberY()
+{
+    return s_cellRows;
+}
+
+bool Screen_EPD_EXT4_Fast::s_getCellPixel(const uint8_t * cells, const uint8_t * attributes, uint16_t x, uint16_t y)
+{
+    uint16_t column = x / 6;
+    uint16_t row = y / 8;
+
+    // Outside the grid = white
+    if ((column >= s_cellColumns) or (row >= s_cellRows))
+    {
+        return false;
+    }
+
+    uint16_t index = row * s_cellColumns + column;
+    bool flagPixel = bitRead(Terminal6x8e[f_getCharacterRow(cells[index])][x % 6], y % 8);
+
+    return flagPixel xor (bool)bitRead(attributes[index >> 3], index % 8);
+}
+
+void Screen_EPD_EXT4_Fast::s_orBits(uint8_t * image, uint16_t base, uint8_t value)
+{
+    uint8_t shift = base % 8;
+
+    image[base >> 3] |= value >> shift;
+
+    // Bits on the next byte, only if any
+    uint8_t next = (shift > 0) ? (uint8_t)(value << (8 - shift)) : 0x00;
+    if (next != 0x00)
+    {
+        image[(base >> 3) + 1] |= next;
+    }
+}
+
+bool Screen_EPD_EXT4_Fast::s_checkCellsChanged()
+{
+    for (uint16_t row = 0; row < s_cellRows; row += 1)
+    {
+        if ((s_cellRowChanged & ((uint64_t)1 << (row % 64))) == 0)
+        {
+            continue;
+        }
+
+        for (uint16_t index = row * s_cellColumns; index < (row + 1) * s_cellColumns; index += 1)
+        {
+            if ((s_cellNext[index] != s_cellPrevious[index]) or (bitRead(s_attributeNext[index >> 3], index % 8) != bitRead(s_attributePrevious[index >> 3], index % 8)))
+            {
+                return true;
+            }
+        }
+    }
+
+    s_cellRowChanged = 0; // Same as previous
+    return false;
+}
+//
+// === End of Character cells section
 //
-// === End of Class section
-//
+#endif // SRAM_MODE
 
 //
 // === Touch section
@@ -57,6 +57,11 @@
 // PDLS utilities
 #include "hV_Utilities_PDLS.h"
 
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+// External SPI memory
+#include "hV_Memory_SPI.h"
+#endif // SRAM_MODE
+
 // Checks
 #if (hV_HAL_PERIPHERALS_RELEASE < 812)
 #error Required hV_HAL_PERIPHERALS_RELEASE 812
@@ -74,6 +79,36 @@
 #error Required hV_BOARD_RELEASE 812
 #endif // hV_BOARD_RELEASE
 
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+#if (hV_MEMORY_SPI_RELEASE < 830)
+#error Required hV_MEMORY_SPI_RELEASE 830
+#endif // hV_MEMORY_SPI_RELEASE
+#endif // SRAM_MODE
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+#if ((FONT_SUBSET & FONT_SUBSET_SYMBOLS) == 0)
+#error Required FONT_SUBSET_SYMBOLS for USE_CHARACTER_CELLS
+#endif // FONT_SUBSET
+#endif // SRAM_MODE
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+#error DISPLAY_LIST not available with USE_CHARACTER_CELLS
+#endif // DISPLAY_LIST
+#endif // SRAM_MODE
+
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+#if (SRAM_MODE != USE_INTERNAL_MCU)
+#error BACKGROUND_MODE requires USE_INTERNAL_MCU
+#endif // SRAM_MODE
+#endif // BACKGROUND_MODE
+
+#if (PAGE_CACHE == USE_PAGE_CACHE_YES)
+#if (SRAM_MODE != USE_INTERNAL_MCU)
+#error PAGE_CACHE requires USE_INTERNAL_MCU
+#endif // SRAM_MODE
+#endif // PAGE_CACHE
+
 #if (USE_EXT_BOARD != BOARD_EXT4)
 #error Required USE_EXT_BOARD = BOARD_EXT4
 #endif // USE_EXT_BOARD
@@ -96,6 +131,144 @@
 #define WITH_FAST_FRIENDS ///< File and serial access
 /// @}
 
+///
+/// @brief Time per phase of a flush
+/// @note All times in us
+///
+struct energyTime_s
+{
+    uint32_t reset; ///< reset of the panel
+    uint32_t powerOn; ///< resume, except reset
+    uint32_t transfer; ///< commands and image data
+    uint32_t busy; ///< wait for panel busy
+    uint32_t total; ///< whole flush
+};
+
+///
+/// @brief Current model per phase of a flush
+/// @note Currents in uA, voltage in mV
+/// @note Default values are indicative, measure the actual board
+///
+struct energyModel_s
+{
+    uint16_t voltage; ///< supply voltage, mV
+    uint16_t reset; ///< current during reset, uA
+    uint16_t powerOn; ///< current during resume, uA
+    uint16_t transfer; ///< current during transfer, uA
+    uint16_t busy; ///< current during busy, uA
+};
+
+///
+/// @brief Energy report
+///
+struct energyReport_s
+{
+    energyTime_s time; ///< time per phase of last flush, us
+    uint32_t energy; ///< energy of last flush, uJ
+    uint32_t energyTotal; ///< cumulated energy since reset, mJ
+    uint32_t flushNumber; ///< number of flushes since reset
+};
+
+///
+/// @brief Statistics of the page cache
+///
+struct pageCacheStatistics_s
+{
+    uint32_t hits; ///< pages restored from the cache
+    uint32_t misses; ///< pages not cached or with another version
+    uint32_t evictions; ///< pages removed to free memory
+    uint32_t bytes; ///< bytes used by the cached pages
+    uint8_t pages; ///< number of cached pages
+};
+
+///
+/// @brief Unknown number of toggled pixels
+/// @note With SRAM_MODE other than USE_INTERNAL_MCU
+///
+#define REFRESH_TOGGLED_UNKNOWN 0xffffffff
+
+///
+/// @name Limits for refresh policies
+/// @{
+#define REFRESH_FAST_LIMIT 8 ///< Fast updates before global update, counter policy
+#define REFRESH_FAST_LIMIT_ADAPTIVE 16 ///< Fast updates before global update, adaptive policy
+#define REFRESH_TOGGLED_LIMIT 200 ///< Toggled pixels before global update, % of screen, adaptive policy
+#define REFRESH_GLOBAL_LIMIT 4 ///< Global updates before regenerate, adaptive policy
+/// @}
+
+///
+/// @brief State for refresh policy
+/// @note Counters since last global update or regenerate
+///
+struct refreshState_s
+{
+    uint16_t fastNumber; ///< fast updates since last global update
+    uint16_t globalNumber; ///< global updates since last regenerate
+    uint32_t toggledPending; ///< pixels toggled by the pending frame, or REFRESH_TOGGLED_UNKNOWN
+    uint32_t toggledTotal; ///< pixels toggled by fast updates since last global update
+    uint32_t pixels; ///< pixels of the screen
+    int8_t temperature; ///< temperature, Celsius
+    uint8_t temperatureMode; ///< checkTemperatureMode(UPDATE_FAST)
+};
+
+///
+/// @brief Decision of refresh policy
+///
+struct refreshDecision_s
+{
+    uint8_t mode; ///< UPDATE_NONE, UPDATE_FAST, UPDATE_GLOBAL or UPDATE_REGENERATE
+    uint8_t reason; ///< REFRESH_REASON_*
+    refreshState_s state; ///< state used for the decision
+};
+
+///
+/// @brief Statistics of flush requests
+/// @see requestFlush()
+///
+struct flushStatistics_s
+{
+    uint32_t requested; ///< calls to requestFlush()
+    uint32_t executed; ///< refreshes of the panel, including flush()
+    uint32_t coalesced; ///< requests merged into a pending refresh
+    uint32_t dropped; ///< refreshes skipped by the refresh policy, no update
+};
+
+///
+/// @brief Refresh policy
+/// @param state state of the screen
+/// @return decision, mode and reason
+///
+typedef refreshDecision_s (* refreshPolicy_t)(refreshState_s state);
+
+///
+/// @brief Fast update only, default policy
+/// @param state state of the screen
+/// @return decision, mode and reason
+/// @note Temperature checked by flushMode()
+///
+refreshDecision_s refreshPolicyFast(refreshState_s state);
+
+///
+/// @brief Global update after REFRESH_FAST_LIMIT fast updates
+/// @param state state of the screen
+/// @return decision, mode and reason
+///
+refreshDecision_s refreshPolicyCounter(refreshState_s state);
+
+///
+/// @brief Adaptive policy
+/// @details
+/// * no update if no pixel toggled
+/// * global update if temperature out of fast update range,
+/// after REFRESH_FAST_LIMIT_ADAPTIVE fast updates
+/// or REFRESH_TOGGLED_LIMIT % of pixels toggled by fast updates
+/// * regenerate instead of global update after REFRESH_GLOBAL_LIMIT global updates
+/// * fast update otherwise
+/// @param state state of the screen
+/// @return decision, mode and reason
+///
+refreshDecision_s refreshPolicyAdaptive(refreshState_s state);
+
 // Objects
 //
 ///
@@ -104,6 +277,8 @@
 /// * LCD: proprietary, SPI
 /// * touch: no touch
 /// * fonts: no external Flash
+/// * frame-buffer: MCU internal SRAM or external SPI SRAM or FRAM, see SRAM_MODE
+/// * text mode: grid of character cells, see SRAM_MODE
 ///
 /// @note All commands work on the frame-buffer,
 /// to be displayed on screen with flush()
@@ -138,6 +313,10 @@ class Screen_EPD_EXT4_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     /// @brief Resume after suspend()
     /// @details Turn SPI on and set all GPIOs levels
+    /// @note Warm resume sets the GPIOs levels without configuring them again.
+    /// Reset and SPI remain, as the panel power is cut.
+    /// @note Call begin() again if the application changes the GPIOs
+    /// @note Statistics available with getPowerStatistics()
     ///
     void resume();
 
@@ -155,11 +334,12 @@ class Screen_EPD_EXT4_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     void clear(uint16_t colour = myColours.white);
 
     ///
-    /// @brief Update the display, global update
+    /// @brief Update the display, mode decided by the refresh policy
     /// @note
     /// 1. Send the frame-buffer to the screen
     /// 2. Refresh the screen
     /// 3. Copy next frame-buffer into old frame-buffer
+    /// @note Fast update with default policy, see setRefreshPolicy()
     ///
     void flush();
 
@@ -173,12 +353,316 @@ class Screen_EPD_EXT4_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     /// @brief Update the display
     /// @details Display next frame-buffer on screen and copy next frame-buffer into old frame-buffer
-    /// @param updateMode expected update mode, default = UPDATE_FAST
+    /// @param updateMode expected update mode, default = UPDATE_FAST, otherwise UPDATE_GLOBAL or UPDATE_REGENERATE
     /// @return uint8_t recommended mode
     /// @note Mode checked with checkTemperatureMode()
+    /// @note UPDATE_REGENERATE keeps the content of the frame-buffer
     ///
     uint8_t flushMode(uint8_t updateMode = UPDATE_FAST);
 
+    ///
+    /// @brief Scroll up a band of the screen
+    /// @param y0 top coordinate of the band, y-axis
+    /// @param dy height of the band, y-axis
+    /// @param number of pixels to scroll up, y-axis
+    /// @param colour 16-bit colour for the pixels freed at the bottom, default = white
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The frame-buffer is shifted along the native axis of the panel with memmove()
+    /// * Orientations 0 and 2: lines of the frame-buffer, any number of pixels
+    /// * Orientations 1 and 3: bytes within each line if y0, dy and number are multiples of 8,
+    /// otherwise bits
+    /// @note Character cells: rows of cells, y0, dy and number multiples of 8
+    /// @note Not available with frame-buffer on external SPI memory
+    ///
+    bool scroll(uint16_t y0, uint16_t dy, uint16_t number, uint16_t colour = myColours.white);
+
+    ///
+    /// @brief Scroll left an area of the screen
+    /// @param x0 top left coordinate of the area, x-axis
+    /// @param y0 top left coordinate of the area, y-axis
+    /// @param dx width of the area, x-axis
+    /// @param dy height of the area, y-axis
+    /// @param number of pixels to scroll left, x-axis
+    /// @param colour 16-bit colour for the pixels freed at the right, default = white
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The frame-buffer is shifted along the native axis of the panel
+    /// * Orientations 1 and 3: bits of the area copied from line to line
+    /// * Orientations 0 and 2: bytes within each line if x0, dx and number are multiples of 8,
+    /// otherwise bits
+    /// @note Not available with frame-buffer on external SPI memory or with character cells
+    ///
+    bool scrollLeft(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t number, uint16_t colour = myColours.white);
+
+    ///
+    /// @brief Set the orientation and rotate the content of the screen accordingly
+    /// @param orientation new orientation, 0..3, ORIENTATION_PORTRAIT or ORIENTATION_LANDSCAPE
+    /// @param colour 16-bit colour for the pixels freed, default = white
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The frame-buffer is transformed in place, without drawing again
+    /// * 180°: bytes in reverse order, bits reversed within each byte
+    /// * 90° and 270°: square at the top left corner transposed by blocks of 8x8 bits,
+    /// the rest of the screen cleared, unless the screen is square
+    /// @note On error, orientation and frame-buffer are left unchanged
+    /// @note The background, if any, is not rotated
+    /// @note Not available with frame-buffer on external SPI memory or with character cells
+    ///
+    /// @n Example
+    /// @code {.cpp}
+    /// if ((orientation + 2) % 4 == myScreen.getOrientation())
+    /// {
+    ///     myScreen.rotate(orientation); // instead of drawing again
+    ///     myScreen.flush();
+    /// }
+    /// @endcode
+    ///
+    bool rotate(uint8_t orientation, uint16_t colour = myColours.white);
+
+    ///
+    /// @brief Read pixel
+    /// @param x1 point coordinate, x-axis
+    /// @param y1 point coordinate, y-axis
+    /// @return 16-bit colour, black or white, white if outside the screen
+    /// @note Orientation and invert are taken into account
+    /// @note Grey is read as black or white, according to the pattern
+    ///
+    uint16_t readPixel(uint16_t x1, uint16_t y1);
+
+    ///
+    /// @brief Fill the area around a point
+    /// @param x0 seed coordinate, x-axis
+    /// @param y0 seed coordinate, y-axis
+    /// @param colour 16-bit colour, black or white
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The pixels connected to the seed with the same colour are filled, 4-connectivity
+    /// @note Scanline algorithm along the native axis of the panel,
+    /// spans found and filled by bytes of the frame-buffer, without recursion
+    /// @note At most FLOOD_FILL_STACK seeds pending, otherwise the area is partially filled
+    /// and RESULT_ERROR is returned
+    /// @note Not available with frame-buffer on external SPI memory or with character cells
+    ///
+    /// @n Example
+    /// @code {.cpp}
+    /// myScreen.setPenSolid(false);
+    /// myScreen.circle(60, 60, 40, myColours.black);
+    /// myScreen.floodFill(60, 60, myColours.black);
+    /// @endcode
+    ///
+    bool floodFill(uint16_t x0, uint16_t y0, uint16_t colour);
+
+    ///
+    /// @brief Set the ordered dithering
+    /// @param matrix DITHER_4X4 or DITHER_8X8, default = DITHER_4X4
+    /// @note Colours other than black and white drawn as patterns of black and white pixels,
+    /// with density according to the luminance of the colour
+    /// * DITHER_4X4: 17 levels
+    /// * DITHER_8X8: 65 levels
+    /// @note Grey is always the checkerboard, half black, half white
+    /// @note The pattern is fixed to the panel, independent from the orientation
+    ///
+    void setDither(uint8_t matrix = DITHER_4X4);
+
+    //
+    // === Refresh section
+    //
+    ///
+    /// @brief Set the refresh policy used by flush()
+    /// @param policy refreshPolicyFast = default, refreshPolicyCounter, refreshPolicyAdaptive or custom function
+    ///
+    void setRefreshPolicy(refreshPolicy_t policy = refreshPolicyFast);
+
+    ///
+    /// @brief Get the last decision of the refresh policy
+    /// @return mode, reason and state
+    ///
+    refreshDecision_s getRefreshDecision();
+
+    ///
+    /// @brief Set the limits of requestFlush()
+    /// @param interval minimum time between two refreshes, ms, default = 0 = none
+    /// @param deadline maximum delay of a request, ms, default = 0 = none
+    /// @note A deadline shorter than the interval gives priority to latency over refresh rate
+    ///
+    void setFlushInterval(uint32_t interval = 0, uint32_t deadline = 0);
+
+    ///
+    /// @brief Request a refresh
+    /// @return true if refreshed now, false if pending
+    /// @details Requests within the minimum interval or during a refresh
+    /// are merged into a single pending refresh, with the latest content of the frame-buffer
+    /// @warning A pending refresh is only executed by serviceFlush(),
+    /// which must be polled from loop(), as nothing runs it in the background
+    /// @warning Not thread-safe, call requestFlush(), serviceFlush() and flush() from the same task
+    ///
+    /// @n Example
+    /// @code {.cpp}
+    /// myScreen.setFlushInterval(2000); // 2 s
+    ///
+    /// void loop()
+    /// {
+    ///     if (flagChanged)
+    ///     {
+    ///         myScreen.requestFlush();
+    ///     }
+    ///     myScreen.serviceFlush();
+    /// }
+    /// @endcode
+    ///
+    bool requestFlush();
+
+    ///
+    /// @brief Execute the pending refresh when the minimum interval has elapsed or the deadline is reached
+    /// @return true if refreshed, false otherwise
+    /// @note Poll from loop(), see requestFlush()
+    ///
+    bool serviceFlush();
+
+    ///
+    /// @brief Get the statistics of flush requests
+    /// @return requests and refreshes since reset
+    ///
+    flushStatistics_s getFlushStatistics();
+
+    ///
+    /// @brief Reset the statistics of flush requests
+    ///
+    void resetFlushStatistics();
+    //
+    // === End of Refresh section
+    //
+
+    //
+    // === Energy section
+    //
+    ///
+    /// @brief Set the current model
+    /// @param model current per phase and voltage
+    ///
+    void setEnergyModel(energyModel_s model);
+
+    ///
+    /// @brief Get the current model
+    /// @return current per phase and voltage
+    ///
+    energyModel_s getEnergyModel();
+
+    ///
+    /// @brief Get the energy report
+    /// @return time and energy of last flush, cumulated energy
+    ///
+    energyReport_s getEnergyReport();
+
+    ///
+    /// @brief Reset the cumulated energy and the number of flushes
+    ///
+    void resetEnergyReport();
+    //
+    // === End of Energy section
+    //
+
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+    //
+    // === Background section
+    //
+    ///
+    /// @brief Save the frame-buffer as background
+    /// @param mode BACKGROUND_OR = default, or BACKGROUND_AND
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error, compressed background larger than BACKGROUND_SIZE
+    /// @note Draw the static elements, save them as background, then clear() and draw the dynamic elements as overlay
+    /// * BACKGROUND_OR: clear(myColours.white), black pixels of the overlay drawn over the background
+    /// * BACKGROUND_AND: clear(myColours.black), white pixels of the overlay drawn over the background
+    /// @note The frame-buffer keeps the overlay only, the background is composed at flush()
+    ///
+    bool saveBackground(uint8_t mode = BACKGROUND_OR);
+
+    ///
+    /// @brief Remove the background
+    ///
+    void clearBackground();
+
+    ///
+    /// @brief Size of the compressed background
+    /// @return number of bytes, 0 = no background
+    ///
+    uint16_t getBackgroundSize();
+    //
+    // === End of Background section
+    //
+#endif // BACKGROUND_MODE
+
+#if (PAGE_CACHE == USE_PAGE_CACHE_YES)
+    //
+    // === Page cache section
+    //
+    ///
+    /// @brief Save the frame-buffer into the page cache
+    /// @param page number of the page
+    /// @param version version of the content of the page
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error, compressed page larger than PAGE_CACHE_SIZE
+    /// @note Least recently used pages are removed to free memory,
+    /// previous version of the same page is replaced
+    ///
+    bool savePage(uint8_t page, uint16_t version);
+
+    ///
+    /// @brief Restore a page from the page cache into the frame-buffer
+    /// @param page number of the page
+    /// @param version version of the content of the page
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error, page not cached or with another version
+    /// @note On error, draw the page and call savePage(); on success, call flush()
+    /// @note With DISPLAY_LIST, call setDisplayList(false) first
+    ///
+    /// @n Example
+    /// @code {.cpp}
+    /// if (myScreen.loadPage(PAGE_ABOUT, version) == RESULT_ERROR)
+    /// {
+    ///     displayAbout(); // draw
+    ///     myScreen.savePage(PAGE_ABOUT, version);
+    /// }
+    /// myScreen.flush();
+    /// @endcode
+    ///
+    bool loadPage(uint8_t page, uint16_t version);
+
+    ///
+    /// @brief Remove all the pages from the page cache
+    ///
+    void clearPageCache();
+
+    ///
+    /// @brief Get the statistics of the page cache
+    /// @return hits, misses and evictions since reset, bytes and pages used
+    ///
+    pageCacheStatistics_s getPageCacheStatistics();
+
+    ///
+    /// @brief Reset the counters of the page cache
+    ///
+    void resetPageCacheStatistics();
+    //
+    // === End of Page cache section
+    //
+#endif // PAGE_CACHE
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+    //
+    // === Character cells section
+    //
+    ///
+    /// @brief Number of cells, x-axis
+    /// @return number of columns for current orientation
+    ///
+    uint16_t cellNumberX();
+
+    ///
+    /// @brief Number of cells, y-axis
+    /// @return number of rows for current orientation
+    ///
+    uint16_t cellNumberY();
+    //
+    // === End of Character cells section
+    //
+#endif // SRAM_MODE
+
   protected:
     /// @cond
 
@@ -214,6 +698,18 @@ class Screen_EPD_EXT4_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     uint16_t s_getPoint(uint16_t x1, uint16_t y1);
 
+    ///
+    /// @brief Set area
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis, x2 >= x1
+    /// @param y2 bottom right coordinate, y-axis, y2 >= y1
+    /// @param colour 16-bit colour
+    /// @note Spans of the frame-buffer filled by bytes along the native axis of the panel,
+    /// same result as s_setPoint() for each pixel
+    ///
+    void s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
     ///
     /// @brief Reset the screen
     ///
@@ -230,6 +726,14 @@ class Screen_EPD_EXT4_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     void s_flush(uint8_t updateMode = UPDATE_FAST);
 
+    ///
+    /// @brief Update the display with toggled pixels already counted
+    /// @param updateMode expected update mode
+    /// @return uint8_t recommended mode
+    /// @note Energy metered across all the phases of the update
+    ///
+    uint8_t s_flushMode(uint8_t updateMode);
+
     // Position
     ///
     /// @brief Convert
@@ -247,14 +751,270 @@ class Screen_EPD_EXT4_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     ///
     uint16_t s_getB(uint16_t x1, uint16_t y1);
 
+    ///
+    /// @brief Shift bits within a line
+    /// @param image line of the frame-buffer
+    /// @param base first bit
+    /// @param size number of bits
+    /// @param number of bits to shift
+    /// @param flagForward true = towards the first bit, false = towards the last bit
+    /// @param pattern 0x00 or 0xff for the bits freed
+    ///
+    void s_shiftBits(uint8_t * image, uint16_t base, uint16_t size, uint16_t number, bool flagForward, uint8_t pattern);
+
+    ///
+    /// @brief Copy bits from a line to another
+    /// @param destination line of the frame-buffer
+    /// @param source line of the frame-buffer, nullptr to fill with pattern
+    /// @param base first bit
+    /// @param size number of bits
+    /// @param pattern 0x00 or 0xff, if source is nullptr
+    ///
+    void s_copyBits(uint8_t * destination, const uint8_t * source, uint16_t base, uint16_t size, uint8_t pattern);
+
+    ///
+    /// @brief Transpose a square of bits in place
+    /// @param image first line of the square
+    /// @param size bytes per line, square of 8 * size lines and 8 * size bits
+    /// @note Blocks of 8x8 bits, bits as s_getB()
+    ///
+    void s_transposeBits(uint8_t * image, uint16_t size);
+
+    ///
+    /// @brief Reverse the order of the bits of a byte
+    /// @param value byte
+    /// @return byte with bits reversed
+    ///
+    uint8_t s_reverseBits(uint8_t value);
+
+    ///
+    /// @brief Find the first bit with another value within a line
+    /// @param image line
+    /// @param bit first bit to check
+    /// @param limit last bit excluded, forward; first bit included, backward
+    /// @param flagValue value of the bits to skip
+    /// @param flagForward true = increasing bits, false = decreasing bits
+    /// @return forward: first bit with another value, or limit;
+    /// backward: last bit with value flagValue, or limit
+    /// @note Whole bytes skipped when possible, bits as s_getB()
+    ///
+    uint16_t s_scanBits(const uint8_t * image, uint16_t bit, uint16_t limit, bool flagValue, bool flagForward);
+
+    ///
+    /// @brief Get the dithering level of a colour
+    /// @param colour 16-bit colour
+    /// @return number of black pixels of the matrix, 0 = white
+    /// @note Last colour kept
+    ///
+    uint8_t s_getDitherLevel(uint16_t colour);
+
+    ///
+    /// @brief Get the dithering pattern of a line
+    /// @param line native line
+    /// @param level number of black pixels of the matrix, from s_getDitherLevel()
+    /// @return byte of the pattern, invert included, bits as s_getB()
+    /// @note The period of the matrix divides 8, so the pattern is the same for all the bytes of the line
+    ///
+    uint8_t s_getDitherRow(uint16_t line, uint8_t level);
+
+    uint8_t s_ditherMatrix; // DITHER_4X4 or DITHER_8X8
+    uint16_t s_ditherColour; // last colour
+    uint8_t s_ditherLevel; // level of last colour
+
+    ///
+    /// @brief Send a frame to the panel
+    /// @param index register
+    /// @param offset offset of the frame, 0 = next, u_pageColourSize = previous
+    /// @note With SRAM_MODE == USE_EXTERNAL_SPI, sending the next frame also copies it into the previous frame
+    /// @note With a background, sending the next frame composes it with the background into the previous frame
+    ///
+    void s_sendIndexFrame(uint8_t index, uint32_t offset);
+
+#if (SRAM_MODE == USE_EXTERNAL_SPI)
+    //
+    // === External SPI memory section
+    //
+    ///
+    /// @brief Get a line from the write-back cache
+    /// @param line line number, native x-axis coordinate
+    /// @param flagWrite true = line to be modified, false = read only
+    /// @return pointer to the cached line, u_bufferSizeH bytes
+    /// @note s_newImage holds EXTERNAL_SPI_CACHE_LINES lines
+    ///
+    uint8_t * s_cacheLine(uint16_t line, bool flagWrite);
+
+    ///
+    /// @brief Write back the modified lines and empty the cache
+    ///
+    void s_cacheFlush();
+
+    hV_Memory_SPI s_memory;
+    uint16_t s_cacheTag[EXTERNAL_SPI_CACHE_LINES]; // line number, 0xffff = empty
+    uint32_t s_cacheAge[EXTERNAL_SPI_CACHE_LINES]; // last use, 0 = empty
+    bool s_cacheDirty[EXTERNAL_SPI_CACHE_LINES];
+    uint32_t s_cacheClock;
+    //
+    // === End of External SPI memory section
+    //
+#endif // SRAM_MODE
+
+#if (SRAM_MODE == USE_CHARACTER_CELLS)
+    //
+    // === Character cells section
+    //
+    ///
+    /// @brief Get the pixel of a character cell
+    /// @param cells grid of character codes
+    /// @param attributes bitmap of inverse attributes
+    /// @param x logical coordinate, x-axis
+    /// @param y logical coordinate, y-axis
+    /// @return true = black, false = white, before u_invert
+    ///
+    bool s_getCellPixel(const uint8_t * cells, const uint8_t * attributes, uint16_t x, uint16_t y);
+
+    ///
+    /// @brief Add up to 8 bits to a line
+    /// @param image line of the frame-buffer
+    /// @param base first bit
+    /// @param value bits to add, first bit as MSB
+    /// @note Bits as s_getB(), no bit set past the last one of the line
+    ///
+    void s_orBits(uint8_t * image, uint16_t base, uint8_t value);
+
+    ///
+    /// @brief Check whether next and previous cells differ
+    /// @return true = changed, false = unchanged
+    /// @note Only rows flagged by gText() and clear() are compared
+    ///
+    bool s_checkCellsChanged();
+
+    ///
+    /// @brief Draw text into the character cells, for all gText() variants
+    /// @param x0 point coordinate, x-axis, rounded down to a cell
+    /// @param y0 point coordinate, y-axis, rounded down to a cell
+    /// @param text string, not necessarily null-terminated
+    /// @param length number of characters to draw
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @param scale ignored, cells of 6x8 pixels only
+    /// @note Terminal6x8 font only
+    /// @note white text on black background sets the inverse attribute
+    /// @return horizontal size written, in pixels
+    ///
+    uint16_t s_drawText(uint16_t x0, uint16_t y0,
+                        const char * text, uint16_t length,
+                        uint16_t textColour, uint16_t backColour,
+                        uint8_t scale);
+
+    uint8_t * s_cellNext; // character code - 0x20
+    uint8_t * s_cellPrevious;
+    uint8_t * s_attributeNext; // 1 bit per cell, inverse
+    uint8_t * s_attributePrevious;
+    uint16_t s_cellNumber; // allocated cells
+    uint16_t s_cellColumns; // for current orientation
+    uint16_t s_cellRows; // for current orientation
+    uint64_t s_cellRowChanged; // 1 bit per row, up to 64 rows
+    //
+    // === End of Character cells section
+    //
+#endif // SRAM_MODE
+
     //
     // === Energy section
     //
+    ///
+    /// @brief Compute the energy of a phase
+    /// @param current current, uA
+    /// @param time time, us
+    /// @return energy, uJ
+    ///
+    uint64_t s_getEnergy(uint16_t current, uint32_t time);
 
+    energyModel_s s_energyModel;
+    energyTime_s s_energyTime; // last flushMode(), all phases
+    uint32_t s_energyLast; // uJ
+    uint64_t s_energyTotal; // uJ
+    uint32_t s_energyNumber;
     //
     // === End of Energy section
     //
 
+    //
+    // === Refresh section
+    //
+    ///
+    /// @brief Send a fixed pattern and refresh with global update
+    /// @param data pattern, 0xff = black, 0x00 = white
+    /// @note Frame-buffer unchanged
+    ///
+    void s_flushFixed(uint8_t data);
+
+    ///
+    /// @brief Count the pixels toggled between next and previous frames
+    /// @return number of pixels, or REFRESH_TOGGLED_UNKNOWN
+    ///
+    uint32_t s_countToggled();
+
+    refreshPolicy_t s_refreshPolicy;
+    refreshState_s s_refreshState;
+    refreshDecision_s s_refreshDecision;
+
+    // Flush requests
+    uint32_t s_flushInterval, s_flushDeadline;
+    uint32_t s_flushLast; // end of last refresh, ms
+    uint32_t s_flushPendingSince; // first request pending, ms
+    bool s_flagFlushLast; // false = no refresh yet
+    bool s_flagFlushPending;
+    bool s_flagFlushBusy; // against re-entry, same task only
+    flushStatistics_s s_flushStatistics;
+    //
+    // === End of Refresh section
+    //
+
+#if (BACKGROUND_MODE == USE_BACKGROUND_YES)
+    //
+    // === Background section
+    //
+    ///
+    /// @brief Compose the background with the next frame
+    /// @param destination frame for the composition, or nullptr to count only
+    /// @return number of pixels toggled between the composition and the previous frame if destination is nullptr, 0 otherwise
+    ///
+    uint32_t s_composeBackground(FRAMEBUFFER_TYPE destination);
+
+    uint8_t s_backgroundData[BACKGROUND_SIZE]; // difference with line before, run-length encoded
+    uint16_t s_backgroundLength; // 0 = no background
+    uint8_t * s_backgroundLine; // background of current line, u_bufferSizeH bytes
+    uint8_t s_backgroundMode;
+    //
+    // === End of Background section
+    //
+#endif // BACKGROUND_MODE
+
+#if (PAGE_CACHE == USE_PAGE_CACHE_YES)
+    //
+    // === Page cache section
+    //
+    ///
+    /// @brief Remove a page from the page cache
+    /// @param index index of the page, moved down with the following pages
+    ///
+    void s_removePage(uint8_t index);
+
+    uint8_t s_pageData[PAGE_CACHE_SIZE]; // compressed pages, packed in order of index
+    uint8_t s_pageNumber[PAGE_CACHE_PAGES];
+    uint16_t s_pageVersion[PAGE_CACHE_PAGES];
+    uint16_t s_pageLength[PAGE_CACHE_PAGES];
+    uint32_t s_pageUse[PAGE_CACHE_PAGES]; // last use, for least recently used
+    uint8_t s_pageCount;
+    uint16_t s_pageBytes;
+    uint32_t s_pageClock;
+    pageCacheStatistics_s s_pageStatistics;
+    //
+    // === End of Page cache section
+    //
+#endif // PAGE_CACHE
+
     // * Other functions specific to the screen
     uint8_t COG_data[128]; // OTP
 
@@ -269,6 +1029,7 @@ class Screen_EPD_EXT4_Fast final : public hV_Screen_Buffer, public hV_Utilities_
     void COG_SmallKP_getDataOTP();
     void COG_SmallKP_initial(uint8_t updateMode);
     void COG_SmallKP_sendImageData(uint8_t updateMode);
+    void COG_SmallKP_sendFixedData(uint8_t data);
     void COG_SmallKP_update(uint8_t updateMode);
     void COG_SmallKP_powerOff();
 
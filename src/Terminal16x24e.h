@@ -59,11 +59,15 @@
 ///
 // #if defined(ENERGIA)
 // unsigned char replaced by uint8_t
-static const uint8_t Terminal16x24e[224][48] =
+extern const uint8_t Terminal16x24e[FONT_SUBSET_NUMBER][48];
+
+#if defined(hV_FONT_TERMINAL_DEFINITION)
+const uint8_t Terminal16x24e[FONT_SUBSET_NUMBER][48] =
     // #elif defined(ARDUINO) || defined(MPIDE) || defined(WIRING)
     // static prog_uchar Terminal16x24e[224][48] PROGMEM =
     // #endif
 {
+#if (FONT_SUBSET & FONT_SUBSET_SYMBOLS) // 0x20~0x3f
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3F, 0x07, 0xFC, 0x3F, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char !
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char "
@@ -96,6 +100,8 @@ static const uint8_t Terminal16x24e[224][48] =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x02, 0xC0, 0x01, 0x07, 0x80, 0x01, 0x03, 0x00, 0x83, 0x01, 0x00, 0xC6, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char >
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x07, 0x0C, 0x3C, 0x07, 0x18, 0x3C, 0x07, 0x38, 0x0E, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char ?
+#endif // FONT_SUBSET_SYMBOLS
+#if (FONT_SUBSET & FONT_SUBSET_UPPERCASE) // 0x40~0x5f
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x80, 0xFF, 0x3F, 0xE0, 0x03, 0x78, 0x70, 0x00, 0x40, 0x18, 0xF8, 0xC3, 0x0C, 0xFE, 0x87, 0x04, 0x07, 0x86, 0x04, 0xE3, 0x83, 0x04, 0xFF, 0x87, 0x0C, 0x0F, 0x46, 0x38, 0x00, 0x07, 0xF0, 0xFF, 0x03, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00 }, // Code for char @
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xFE, 0x00, 0xC0, 0xCF, 0x00, 0xF0, 0xC1, 0x00, 0x10, 0xC0, 0x00, 0xF0, 0xC0, 0x00, 0xE0, 0xC7, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x01, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 }, // Code for char A
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0x07, 0x30, 0x0C, 0x06, 0x30, 0x0C, 0x06, 0x30, 0x0C, 0x06, 0x30, 0x0C, 0x06, 0x70, 0x0E, 0x06, 0xE0, 0x1B, 0x03, 0xC0, 0xF9, 0x03, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char B
@@ -128,6 +134,8 @@ static const uint8_t Terminal16x24e[224][48] =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char ]
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0xC0, 0x01, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char ^
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00 }, // Code for char _
+#endif // FONT_SUBSET_UPPERCASE
+#if (FONT_SUBSET & FONT_SUBSET_LOWERCASE) // 0x60~0x7f
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char `
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xE3, 0x03, 0x80, 0x71, 0x06, 0x80, 0x31, 0x06, 0x80, 0x31, 0x06, 0x80, 0x31, 0x06, 0x80, 0x31, 0x07, 0x80, 0x33, 0x03, 0x00, 0xFF, 0x07, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char a
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0xFC, 0xFF, 0x07, 0x00, 0x07, 0x06, 0x00, 0x03, 0x06, 0x80, 0x01, 0x06, 0x80, 0x01, 0x06, 0x80, 0x01, 0x07, 0x80, 0x83, 0x03, 0x00, 0xFF, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char b
@@ -160,6 +168,8 @@ static const uint8_t Terminal16x24e[224][48] =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x1C, 0x00, 0xE0, 0xF8, 0xE7, 0x7F, 0xF0, 0xFF, 0x3F, 0x00, 0x3C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char }
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00 }, // Code for char ~
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x03, 0x10, 0x00, 0x02, 0x10, 0x00, 0x02, 0x10, 0x00, 0x02, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char 
+#endif // FONT_SUBSET_LOWERCASE
+#if (FONT_SUBSET & FONT_SUBSET_EXTENDED) // 0x80~0x9f
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x7F, 0x00, 0xC0, 0xFF, 0x01, 0xE0, 0xCB, 0x03, 0x60, 0x0A, 0x03, 0x30, 0x0A, 0x06, 0x30, 0x0A, 0x06, 0x30, 0x0A, 0x06, 0x70, 0x02, 0x06, 0x70, 0x00, 0x07, 0x20, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
@@ -192,6 +202,8 @@ static const uint8_t Terminal16x24e[224][48] =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x03, 0x0F, 0x00, 0x03, 0x1E, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x07, 0x00, 0x1C, 0x00, 0x03, 0x0F, 0x00, 0xC3, 0x03, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
+#endif // FONT_SUBSET_EXTENDED
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_A0) // 0xa0~0xbf
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF3, 0xFF, 0x80, 0xF3, 0xFF, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0xC1, 0x00, 0xE0, 0x80, 0x39, 0x60, 0xF0, 0x3F, 0xE0, 0xFF, 0x01, 0xFE, 0x87, 0x01, 0x6E, 0x80, 0x01, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
@@ -224,6 +236,8 @@ static const uint8_t Terminal16x24e[224][48] =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x04, 0x08, 0x00, 0x06, 0xFC, 0x81, 0x03, 0xFC, 0xC1, 0x01, 0x00, 0x70, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x80, 0x23, 0x04, 0xC0, 0x11, 0x06, 0x70, 0x10, 0x07, 0x38, 0xF0, 0x05, 0x0C, 0xE0, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x06, 0x94, 0x80, 0x03, 0x94, 0xC0, 0x01, 0xFC, 0x70, 0x00, 0x6C, 0x38, 0x00, 0x00, 0x0E, 0x03, 0x00, 0xE7, 0x03, 0xC0, 0x71, 0x02, 0x70, 0xF0, 0x07, 0x38, 0xF0, 0x07, 0x0C, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x80, 0x3F, 0x00, 0xC0, 0x71, 0x80, 0xF3, 0x60, 0x80, 0xF3, 0xC0, 0x80, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
+#endif // FONT_SUBSET_LATIN1_A0
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_C0) // 0xc0~0xdf
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x01, 0xE0, 0x07, 0x03, 0xFE, 0x00, 0xC7, 0xCF, 0x00, 0xF6, 0xC1, 0x00, 0x14, 0xC0, 0x00, 0xF0, 0xC0, 0x00, 0xE0, 0xC7, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xF8, 0x01, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xFE, 0x00, 0xC0, 0xCF, 0x00, 0xF4, 0xC1, 0x00, 0x16, 0xC0, 0x00, 0xF7, 0xC0, 0x00, 0xE3, 0xC7, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xF8, 0x01, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xE0, 0x07, 0x04, 0xFE, 0x00, 0xC6, 0xCF, 0x00, 0xF3, 0xC1, 0x00, 0x13, 0xC0, 0x00, 0xF3, 0xC0, 0x00, 0xE6, 0xC7, 0x00, 0x04, 0xFF, 0x00, 0x00, 0xF8, 0x01, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 }, // Code for char �
@@ -256,6 +270,8 @@ static const uint8_t Terminal16x24e[224][48] =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x04, 0xF8, 0x07, 0x06, 0xF8, 0x07, 0x07, 0x1C, 0x00, 0x03, 0x0F, 0x00, 0xC1, 0x03, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0x07, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xE0, 0x00, 0x80, 0x61, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07, 0xF8, 0xFF, 0x07, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x0E, 0x06, 0x8C, 0x1F, 0x06, 0x8C, 0x39, 0x06, 0xF8, 0x70, 0x06, 0x70, 0xE0, 0x03, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
+#endif // FONT_SUBSET_LATIN1_C0
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_E0) // 0xe0~0xff
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x04, 0xE3, 0x03, 0x8C, 0x71, 0x06, 0x9C, 0x31, 0x06, 0x98, 0x31, 0x06, 0x90, 0x31, 0x06, 0x80, 0x31, 0x07, 0x80, 0x33, 0x03, 0x00, 0xFF, 0x07, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xE3, 0x03, 0x80, 0x71, 0x06, 0x90, 0x31, 0x06, 0x98, 0x31, 0x06, 0x9C, 0x31, 0x06, 0x8C, 0x31, 0x07, 0x84, 0x33, 0x03, 0x00, 0xFF, 0x07, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x10, 0xE3, 0x03, 0x98, 0x71, 0x06, 0x8C, 0x31, 0x06, 0x84, 0x31, 0x06, 0x8C, 0x31, 0x06, 0x98, 0x31, 0x07, 0x90, 0x33, 0x03, 0x00, 0xFF, 0x07, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
@@ -288,6 +304,8 @@ static const uint8_t Terminal16x24e[224][48] =
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x03, 0xC0, 0x80, 0x0F, 0xC0, 0x00, 0x7E, 0xE0, 0x00, 0xF0, 0x71, 0x10, 0xC0, 0x3F, 0x18, 0x00, 0x1E, 0x1C, 0xC0, 0x07, 0x0C, 0xF0, 0x00, 0x04, 0x3E, 0x00, 0x80, 0x0F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x07, 0x06, 0x00, 0x03, 0x06, 0x80, 0x01, 0x06, 0x80, 0x01, 0x06, 0x80, 0x01, 0x07, 0x80, 0x83, 0x03, 0x00, 0xFF, 0x01, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // Code for char �
     { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x03, 0xC0, 0x80, 0x0F, 0xC0, 0x1C, 0x7E, 0xE0, 0x1C, 0xF0, 0x71, 0x1C, 0xC0, 0x3F, 0x00, 0x00, 0x1E, 0x00, 0xC0, 0x07, 0x1C, 0xF0, 0x00, 0x1C, 0x3E, 0x00, 0x9C, 0x0F, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } // Code for char �
+#endif // FONT_SUBSET_LATIN1_E0
 };
+#endif // hV_FONT_TERMINAL_DEFINITION
 
 #endif
@@ -52,11 +52,15 @@
 ///
 // #if defined(ENERGIA)
 // unsigned char replaced by uint8_t
-static const uint8_t Terminal6x8e[224][6] =
+extern const uint8_t Terminal6x8e[FONT_SUBSET_NUMBER][6];
+
+#if defined(hV_FONT_TERMINAL_DEFINITION)
+const uint8_t Terminal6x8e[FONT_SUBSET_NUMBER][6] =
     // #elif defined(ARDUINO) || defined(MPIDE) || defined(WIRING)
     // static prog_uchar Terminal6x8e[224][6] PROGMEM =
     // #endif
 {
+#if (FONT_SUBSET & FONT_SUBSET_SYMBOLS) // 0x20~0x3f
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x06, 0x5F, 0x06, 0x00,
     0x00, 0x07, 0x03, 0x00, 0x07, 0x03,
@@ -89,6 +93,8 @@ static const uint8_t Terminal6x8e[224][6] =
     0x00, 0x24, 0x24, 0x24, 0x24, 0x24,
     0x00, 0x00, 0x41, 0x22, 0x14, 0x08,
     0x00, 0x02, 0x01, 0x59, 0x09, 0x06,
+#endif // FONT_SUBSET_SYMBOLS
+#if (FONT_SUBSET & FONT_SUBSET_UPPERCASE) // 0x40~0x5f
     0x00, 0x3E, 0x41, 0x5D, 0x55, 0x1E,
     0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E,
     0x00, 0x7F, 0x49, 0x49, 0x49, 0x36,
@@ -121,6 +127,8 @@ static const uint8_t Terminal6x8e[224][6] =
     0x00, 0x00, 0x41, 0x41, 0x7F, 0x00,
     0x00, 0x04, 0x02, 0x01, 0x02, 0x04,
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+#endif // FONT_SUBSET_UPPERCASE
+#if (FONT_SUBSET & FONT_SUBSET_LOWERCASE) // 0x60~0x7f
     0x00, 0x00, 0x03, 0x07, 0x00, 0x00,
     0x00, 0x20, 0x54, 0x54, 0x54, 0x78,
     0x00, 0x7F, 0x44, 0x44, 0x44, 0x38,
@@ -153,6 +161,8 @@ static const uint8_t Terminal6x8e[224][6] =
     0x00, 0x00, 0x41, 0x41, 0x3E, 0x08,
     0x00, 0x02, 0x01, 0x02, 0x01, 0x00,
     0x00, 0x3C, 0x26, 0x23, 0x26, 0x3C,
+#endif // FONT_SUBSET_LOWERCASE
+#if (FONT_SUBSET & FONT_SUBSET_EXTENDED) // 0x80~0x9f
     0x00, 0x14, 0x3E, 0x55, 0x41, 0x21,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0xE0, 0x60, 0x00, 0x00,
@@ -185,6 +195,8 @@ static const uint8_t Terminal6x8e[224][6] =
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x64, 0x55, 0x56, 0x4D, 0x00,
     0x00, 0x04, 0x09, 0x70, 0x09, 0x04,
+#endif // FONT_SUBSET_EXTENDED
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_A0) // 0xa0~0xbf
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x60, 0xFA, 0x60, 0x00,
     0x00, 0x18, 0x24, 0x66, 0x24, 0x00,
@@ -217,6 +229,8 @@ static const uint8_t Terminal6x8e[224][6] =
     0x00, 0x17, 0x08, 0x4C, 0x6A, 0x50,
     0x05, 0x17, 0x0A, 0x34, 0x2A, 0x79,
     0x00, 0x30, 0x48, 0x4D, 0x40, 0x20,
+#endif // FONT_SUBSET_LATIN1_A0
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_C0) // 0xc0~0xdf
     0x00, 0x70, 0x29, 0x25, 0x28, 0x70,
     0x00, 0x70, 0x28, 0x25, 0x29, 0x70,
     0x00, 0x70, 0x29, 0x25, 0x29, 0x70,
@@ -249,6 +263,8 @@ static const uint8_t Terminal6x8e[224][6] =
     0x00, 0x04, 0x08, 0x71, 0x09, 0x04,
     0x00, 0xFE, 0xAA, 0x28, 0x10, 0x00,
     0x00, 0xFE, 0x4A, 0x4A, 0x34, 0x00,
+#endif // FONT_SUBSET_LATIN1_C0
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_E0) // 0xe0~0xff
     0x00, 0x20, 0x55, 0x55, 0x54, 0x78,
     0x00, 0x20, 0x54, 0x54, 0x55, 0x79,
     0x00, 0x20, 0x55, 0x55, 0x55, 0x78,
@@ -281,7 +297,9 @@ static const uint8_t Terminal6x8e[224][6] =
     0x00, 0x9C, 0xA0, 0x61, 0x3D, 0x00,
     0x00, 0xFF, 0xA5, 0x24, 0x18, 0x00,
     0x00, 0x9C, 0xA1, 0x60, 0x3D, 0x00
+#endif // FONT_SUBSET_LATIN1_E0
 };
+#endif // hV_FONT_TERMINAL_DEFINITION
 
 #endif
 
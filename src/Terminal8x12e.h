@@ -47,240 +47,261 @@
 /// @brief Font Terminal8x12e
 /// @details GLCD FontName : Terminal8x12e
 /// @n GLCD FontSize : 8 x 12
+/// @n Bit-packed, 12 bytes per character
+/// * bytes 0~7: rows 0~7 of columns 0~7
+/// * bytes 8~11: rows 8~11 of columns 2n on low nibble and 2n+1 on high nibble
 ///
 /// @copyright Font generated manually
 ///
 // #if defined(ENERGIA)
 // unsigned char replaced by uint8_t
-static const uint8_t Terminal8x12e[224][16] =
+extern const uint8_t Terminal8x12e[FONT_SUBSET_NUMBER][12];
+
+#if defined(hV_FONT_TERMINAL_DEFINITION)
+const uint8_t Terminal8x12e[FONT_SUBSET_NUMBER][12] =
     // #elif defined(ARDUINO) || defined(MPIDE) || defined(WIRING)
     // static prog_uchar Terminal8x12e[224][16] PROGMEM =
     // #endif
 {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x7E, 0x03, 0x7E, 0x03, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x88, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x88, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x88, 0x00,
-    0x00, 0x00, 0x0C, 0x01, 0x1E, 0x03, 0x33, 0x0E, 0x63, 0x0E, 0xC6, 0x03, 0x84, 0x01, 0x00, 0x00,
-    0x06, 0x00, 0x8F, 0x01, 0xC9, 0x00, 0x6F, 0x03, 0xB6, 0x07, 0x98, 0x04, 0x8C, 0x07, 0x00, 0x03,
-    0x00, 0x00, 0xEC, 0x01, 0xFE, 0x03, 0x12, 0x02, 0x5E, 0x02, 0xCC, 0x01, 0xC0, 0x03, 0x40, 0x02,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFE, 0x03, 0x07, 0x07, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x07, 0x07, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0xA8, 0x00, 0xF8, 0x00, 0x70, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0x20, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xFE, 0x03, 0xC2, 0x02, 0x1A, 0x02, 0xFE, 0x03, 0xFC, 0x01,
-    0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0C, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x03, 0x8E, 0x03, 0xC2, 0x02, 0x62, 0x02, 0x3E, 0x02, 0x1C, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x8C, 0x01, 0x8E, 0x03, 0x22, 0x02, 0x22, 0x02, 0xFE, 0x03, 0xDC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xC0, 0x00, 0xFE, 0x00, 0xBE, 0x00, 0x80, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x80, 0x00,
-    0x00, 0x00, 0x3E, 0x02, 0x3E, 0x02, 0x22, 0x02, 0x22, 0x03, 0xE2, 0x01, 0xC2, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x03, 0x1E, 0x02, 0x16, 0x02, 0xF2, 0x03, 0xE0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x82, 0x03, 0xE2, 0x03, 0x7A, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xDC, 0x01, 0xFE, 0x03, 0x32, 0x02, 0x62, 0x02, 0xFE, 0x03, 0xDC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x3C, 0x00, 0x7E, 0x02, 0x42, 0x03, 0xC2, 0x03, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0B, 0x18, 0x0F, 0x18, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xD8, 0x00, 0x8C, 0x01, 0x06, 0x03, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x06, 0x03, 0x8C, 0x01, 0xD8, 0x00, 0x70, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x62, 0x03, 0x72, 0x03, 0x1E, 0x00, 0x0C, 0x00, 0x00, 0x00,
-    0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x62, 0x02, 0xF2, 0x02, 0x92, 0x02, 0xFE, 0x02, 0xFC, 0x02,
-    0x00, 0x00, 0xF8, 0x03, 0xFC, 0x03, 0x46, 0x00, 0x46, 0x00, 0xFC, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x22, 0x02, 0xFE, 0x03, 0xDC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x02, 0x02, 0x8E, 0x03, 0x8C, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x02, 0x02, 0x06, 0x03, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x02, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x42, 0x02, 0xCE, 0x03, 0xCC, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x20, 0x00, 0x20, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x01, 0x80, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFE, 0x03, 0xFE, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x20, 0x00, 0xF8, 0x00, 0xDE, 0x03, 0x06, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x08, 0x00, 0x70, 0x00, 0x08, 0x00, 0xFE, 0x03, 0xFE, 0x03,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xFE, 0x03, 0xFE, 0x03,
-    0x00, 0x00, 0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x02, 0x02, 0xFE, 0x03, 0xFC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x22, 0x00, 0x3E, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x02, 0x06, 0xFE, 0x0F, 0xFC, 0x09, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x62, 0x00, 0xFE, 0x03, 0x9C, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x0C, 0x01, 0x1E, 0x03, 0x32, 0x02, 0x62, 0x02, 0xC6, 0x03, 0x84, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x01, 0xFE, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFE, 0x03, 0xFE, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x00, 0xFE, 0x01, 0x00, 0x03, 0x00, 0x03, 0xFE, 0x01, 0xFE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x7E, 0x00, 0xFE, 0x03, 0x80, 0x03, 0x70, 0x00, 0x80, 0x03, 0xFE, 0x03, 0x7E, 0x00,
-    0x00, 0x00, 0x86, 0x03, 0xCE, 0x03, 0x38, 0x00, 0x70, 0x00, 0xCE, 0x03, 0x86, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0xE0, 0x03, 0xE0, 0x03, 0x3E, 0x00, 0x1E, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x82, 0x03, 0xC2, 0x03, 0x62, 0x02, 0x32, 0x02, 0x1E, 0x02, 0x0E, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0x01, 0x08, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x01, 0x08, 0xFF, 0x0F, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x01, 0xC8, 0x03, 0x48, 0x02, 0x48, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, 0x18, 0x03, 0x10, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x03, 0x48, 0x02, 0x48, 0x02, 0x78, 0x02, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0xFC, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x08, 0xF8, 0x09, 0x08, 0x09, 0x08, 0x09, 0xF8, 0x0F, 0xF8, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x03, 0xF0, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0x08, 0x02, 0xFB, 0x03, 0xFB, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFB, 0x0F, 0xFB, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x40, 0x00, 0xE0, 0x00, 0xB8, 0x03, 0x18, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x08, 0x00, 0xF8, 0x01, 0x08, 0x00, 0xF8, 0x03, 0xF0, 0x03,
-    0x00, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x03, 0xF0, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x0F, 0xF8, 0x0F, 0x08, 0x01, 0x08, 0x01, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0xF8, 0x01, 0x08, 0x01, 0x08, 0x01, 0xF8, 0x0F, 0xF8, 0x0F, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x20, 0x00, 0x10, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x02, 0x78, 0x02, 0x48, 0x02, 0x48, 0x02, 0xC8, 0x03, 0x88, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x00, 0xFE, 0x01, 0xFE, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xF8, 0x03, 0x00, 0x02, 0x00, 0x02, 0xF8, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x01, 0x00, 0x03, 0x00, 0x03, 0xF8, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x00, 0xF8, 0x03, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00,
-    0x00, 0x00, 0x18, 0x03, 0xB8, 0x03, 0xE0, 0x00, 0xE0, 0x00, 0xB8, 0x03, 0x18, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x08, 0xF8, 0x09, 0x00, 0x0D, 0x00, 0x0F, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x03, 0x88, 0x03, 0xC8, 0x02, 0x68, 0x02, 0x38, 0x02, 0x18, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x70, 0x00, 0xDE, 0x03, 0x8F, 0x07, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x8F, 0x07, 0xDE, 0x03, 0x70, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x0C, 0x00, 0x06, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x06, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x50, 0x00, 0xFC, 0x01, 0xFE, 0x03, 0x52, 0x02, 0x02, 0x02, 0x04, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0xFE, 0x07, 0xFE, 0x07, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x98, 0x01, 0x98, 0x01, 0xFE, 0x07, 0xFE, 0x07, 0x98, 0x01, 0x98, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x0E, 0x00, 0x0A, 0x06, 0x8E, 0x01, 0x60, 0x04, 0x18, 0x00, 0x06, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0x02, 0x04, 0x02, 0x04, 0xFE, 0x07, 0x22, 0x04, 0x02, 0x04, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x0F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xD8, 0x0F, 0xD8, 0x0F, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x00, 0xF8, 0x01, 0x0E, 0x07, 0x0E, 0x07, 0x98, 0x01, 0x90, 0x00, 0x00, 0x00,
-    0x20, 0x03, 0xFC, 0x03, 0xFE, 0x02, 0x22, 0x02, 0x22, 0x02, 0x26, 0x02, 0x04, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xB4, 0x00, 0xFC, 0x00, 0x48, 0x00, 0x48, 0x00, 0xFC, 0x00, 0xB4, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAE, 0x00, 0xBE, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xBE, 0x00, 0xAE, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0x3E, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x66, 0x04, 0xFF, 0x0C, 0x99, 0x09, 0x99, 0x09, 0xF3, 0x0F, 0x62, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
-    0xFC, 0x01, 0x06, 0x03, 0x72, 0x02, 0x8A, 0x02, 0x8A, 0x02, 0x52, 0x02, 0x06, 0x03, 0xFC, 0x01,
-    0x00, 0x00, 0x90, 0x00, 0xBA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xBE, 0x00, 0xBC, 0x00, 0x00, 0x00,
-    0x80, 0x00, 0xC0, 0x01, 0x60, 0x03, 0x20, 0x02, 0x80, 0x00, 0xC0, 0x01, 0x60, 0x03, 0x20, 0x02,
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0xFC, 0x01, 0x06, 0x03, 0xFA, 0x02, 0x4A, 0x02, 0x4A, 0x02, 0xB2, 0x02, 0x06, 0x03, 0xFC, 0x01,
-    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
-    0x00, 0x00, 0x06, 0x00, 0x0F, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0F, 0x00, 0x06, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x02, 0x20, 0x02, 0xF8, 0x02, 0xF8, 0x02, 0x20, 0x02, 0x20, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x3A, 0x00, 0x2E, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2A, 0x00, 0x3E, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0xFC, 0x0F, 0xFC, 0x07, 0x00, 0x01, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0x00, 0x01,
-    0x00, 0x00, 0x1C, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0x01, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x9C, 0x00, 0xBE, 0x00, 0xA2, 0x00, 0xA2, 0x00, 0xBE, 0x00, 0x9C, 0x00, 0x00, 0x00,
-    0x20, 0x02, 0x60, 0x03, 0xC0, 0x01, 0x80, 0x00, 0x20, 0x02, 0x60, 0x03, 0xC0, 0x01, 0x80, 0x00,
-    0x02, 0x01, 0x9F, 0x01, 0xDF, 0x00, 0x60, 0x03, 0xB0, 0x03, 0xD8, 0x02, 0xCC, 0x07, 0xC4, 0x07,
-    0x02, 0x01, 0x9F, 0x01, 0xDF, 0x00, 0x60, 0x00, 0x70, 0x06, 0x58, 0x07, 0xCC, 0x05, 0x84, 0x04,
-    0x11, 0x01, 0x95, 0x01, 0xDF, 0x00, 0x6A, 0x03, 0xB0, 0x03, 0xD8, 0x02, 0xCC, 0x07, 0xC4, 0x07,
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x0F, 0xD8, 0x09, 0xD8, 0x08, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x03, 0xFD, 0x03, 0x47, 0x00, 0x46, 0x00, 0xFC, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x03, 0xFC, 0x03, 0x46, 0x00, 0x47, 0x00, 0xFD, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x03, 0xFD, 0x03, 0x47, 0x00, 0x47, 0x00, 0xFD, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF2, 0x03, 0xF9, 0x03, 0x4D, 0x00, 0x4E, 0x00, 0xFA, 0x03, 0xF1, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x03, 0xFD, 0x03, 0x46, 0x00, 0x46, 0x00, 0xFD, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x03, 0xFA, 0x03, 0x4D, 0x00, 0x4D, 0x00, 0xFA, 0x03, 0xF0, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x03, 0xF8, 0x03, 0x4C, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x22, 0x02,
-    0x00, 0x00, 0xFC, 0x00, 0xFE, 0x09, 0x02, 0x0B, 0x02, 0x0F, 0xCE, 0x05, 0xCC, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xFD, 0x03, 0x25, 0x02, 0x24, 0x02, 0x24, 0x02, 0x04, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xFC, 0x03, 0x24, 0x02, 0x25, 0x02, 0x25, 0x02, 0x04, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xFD, 0x03, 0x25, 0x02, 0x25, 0x02, 0x25, 0x02, 0x04, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xFD, 0x03, 0x24, 0x02, 0x24, 0x02, 0x25, 0x02, 0x04, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0xFC, 0x03, 0xFD, 0x03, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0xFD, 0x03, 0xFD, 0x03, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0x05, 0x02, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x06, 0x03, 0xFC, 0x01, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFA, 0x03, 0xF9, 0x03, 0x31, 0x00, 0x62, 0x00, 0xC2, 0x00, 0xF9, 0x03, 0xF8, 0x03,
-    0x00, 0x00, 0xF8, 0x01, 0xFD, 0x03, 0x05, 0x02, 0x04, 0x02, 0xFC, 0x03, 0xF8, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xFC, 0x03, 0x04, 0x02, 0x05, 0x02, 0xFD, 0x03, 0xF8, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xFD, 0x03, 0x05, 0x02, 0x05, 0x02, 0xFD, 0x03, 0xF8, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xFD, 0x03, 0x05, 0x02, 0x05, 0x02, 0xFD, 0x03, 0xF8, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xFD, 0x03, 0x04, 0x02, 0x04, 0x02, 0xFD, 0x03, 0xF8, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x8C, 0x01, 0xD8, 0x00, 0x70, 0x00, 0x70, 0x00, 0xD8, 0x00, 0x8C, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xFE, 0x03, 0xE2, 0x02, 0x3A, 0x02, 0xFE, 0x03, 0xFE, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xFD, 0x03, 0x01, 0x02, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xFC, 0x03, 0x00, 0x02, 0x01, 0x02, 0xFD, 0x03, 0xFC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xFD, 0x03, 0x01, 0x02, 0x01, 0x02, 0xFD, 0x03, 0xFC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x01, 0xFD, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0xE0, 0x03, 0xE1, 0x03, 0x3D, 0x00, 0x1C, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x88, 0x00, 0x88, 0x00, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0x03, 0xFE, 0x03, 0x02, 0x00, 0x1E, 0x02, 0xFC, 0x03, 0xE0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x01, 0xC9, 0x03, 0x4B, 0x02, 0x4A, 0x02, 0xF8, 0x03, 0xF0, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x01, 0xC8, 0x03, 0x4A, 0x02, 0x4B, 0x02, 0xF9, 0x03, 0xF0, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x01, 0xCA, 0x03, 0x49, 0x02, 0x49, 0x02, 0xFA, 0x03, 0xF0, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x82, 0x01, 0xC9, 0x03, 0x49, 0x02, 0x4A, 0x02, 0xFA, 0x03, 0xF1, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x83, 0x01, 0xCB, 0x03, 0x48, 0x02, 0x48, 0x02, 0xFB, 0x03, 0xF3, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x01, 0xD2, 0x03, 0x55, 0x02, 0x55, 0x02, 0xF2, 0x03, 0xE0, 0x03, 0x00, 0x00,
-    0x80, 0x01, 0xC8, 0x03, 0x48, 0x02, 0xF0, 0x03, 0xF8, 0x01, 0x48, 0x02, 0x78, 0x02, 0x70, 0x02,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x0B, 0x08, 0x0A, 0x08, 0x0E, 0x18, 0x03, 0x10, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF9, 0x03, 0x4B, 0x02, 0x4A, 0x02, 0x78, 0x02, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x03, 0x4A, 0x02, 0x4B, 0x02, 0x79, 0x02, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xFA, 0x03, 0x49, 0x02, 0x49, 0x02, 0x7A, 0x02, 0x70, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF3, 0x01, 0xFB, 0x03, 0x48, 0x02, 0x48, 0x02, 0x7B, 0x02, 0x73, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0x09, 0x02, 0xFB, 0x03, 0xFA, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0x08, 0x02, 0xFA, 0x03, 0xFB, 0x03, 0x01, 0x02, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x02, 0x0A, 0x02, 0xF9, 0x03, 0xF9, 0x03, 0x02, 0x02, 0x00, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0x0B, 0x02, 0x0B, 0x02, 0xF8, 0x03, 0xF8, 0x03, 0x03, 0x02, 0x03, 0x02, 0x00, 0x00,
-    0x00, 0x00, 0xE8, 0x01, 0xEA, 0x03, 0x16, 0x02, 0x1C, 0x02, 0xFA, 0x03, 0xF2, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xFA, 0x03, 0xF9, 0x03, 0x09, 0x00, 0x0A, 0x00, 0xFA, 0x03, 0xF1, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF9, 0x03, 0x0B, 0x02, 0x0A, 0x02, 0xF8, 0x03, 0xF0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xF8, 0x03, 0x0A, 0x02, 0x0B, 0x02, 0xF9, 0x03, 0xF0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x01, 0xFA, 0x03, 0x09, 0x02, 0x09, 0x02, 0xFA, 0x03, 0xF0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF2, 0x01, 0xF9, 0x03, 0x09, 0x02, 0x0A, 0x02, 0xFA, 0x03, 0xF1, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF3, 0x01, 0xFB, 0x03, 0x08, 0x02, 0x08, 0x02, 0xFB, 0x03, 0xF3, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xAC, 0x01, 0xAC, 0x01, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xF0, 0x03, 0xF8, 0x03, 0xC8, 0x02, 0x68, 0x02, 0xF8, 0x03, 0xF8, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xF9, 0x03, 0x03, 0x02, 0x02, 0x02, 0xF8, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xF8, 0x01, 0xF8, 0x03, 0x02, 0x02, 0x03, 0x02, 0xF9, 0x03, 0xF8, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xFA, 0x01, 0xFB, 0x03, 0x01, 0x02, 0x01, 0x02, 0xFB, 0x03, 0xFA, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0xFB, 0x01, 0xFB, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFB, 0x03, 0xFB, 0x03, 0x00, 0x00,
-    0x00, 0x08, 0xF8, 0x08, 0xF8, 0x09, 0x02, 0x0D, 0x03, 0x07, 0xF9, 0x03, 0xF8, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0x08, 0x01, 0x08, 0x01, 0xF8, 0x01, 0xF0, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0xFB, 0x08, 0xFB, 0x09, 0x00, 0x0D, 0x00, 0x07, 0xFB, 0x03, 0xFB, 0x00, 0x00, 0x00
+#if (FONT_SUBSET & FONT_SUBSET_SYMBOLS) // 0x20~0x3f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x7E, 0x7E, 0x1C, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0x0E, 0x0E, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0xFE, 0xFE, 0x88, 0xFE, 0xFE, 0x88, 0x00, 0x33, 0x30, 0x03,
+    0x00, 0x0C, 0x1E, 0x33, 0x63, 0xC6, 0x84, 0x00, 0x10, 0xE3, 0x3E, 0x01,
+    0x06, 0x8F, 0xC9, 0x6F, 0xB6, 0x98, 0x8C, 0x00, 0x10, 0x30, 0x47, 0x37,
+    0x00, 0xEC, 0xFE, 0x12, 0x5E, 0xCC, 0xC0, 0x40, 0x10, 0x23, 0x12, 0x23,
+    0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF8, 0xFE, 0x07, 0x01, 0x00, 0x00, 0x00, 0x30, 0x47, 0x00,
+    0x00, 0x00, 0x01, 0x07, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x74, 0x03, 0x00,
+    0x00, 0x20, 0xA8, 0xF8, 0x70, 0xF8, 0xA8, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0xF8, 0xF8, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x7F, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00,
+    0x00, 0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x00, 0x30, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0xFE, 0xC2, 0x1A, 0xFE, 0xFC, 0x00, 0x31, 0x22, 0x13,
+    0x00, 0x08, 0x08, 0x0C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00,
+    0x00, 0x0C, 0x8E, 0xC2, 0x62, 0x3E, 0x1C, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0x8C, 0x8E, 0x22, 0x22, 0xFE, 0xDC, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xC0, 0xFE, 0xBE, 0x80, 0xF8, 0xF8, 0x80, 0x00, 0x00, 0x30, 0x03,
+    0x00, 0x3E, 0x3E, 0x22, 0x22, 0xE2, 0xC2, 0x00, 0x20, 0x22, 0x13, 0x00,
+    0x00, 0xF0, 0xF8, 0x1E, 0x16, 0xF2, 0xE0, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0x02, 0x82, 0xE2, 0x7A, 0x1E, 0x06, 0x00, 0x00, 0x33, 0x00, 0x00,
+    0x00, 0xDC, 0xFE, 0x32, 0x62, 0xFE, 0xDC, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0x3C, 0x7E, 0x42, 0xC2, 0xFE, 0x7C, 0x00, 0x00, 0x32, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0xB0, 0x7F, 0x00,
+    0x00, 0x20, 0x70, 0xD8, 0x8C, 0x06, 0x02, 0x00, 0x00, 0x00, 0x31, 0x02,
+    0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x02, 0x06, 0x8C, 0xD8, 0x70, 0x20, 0x00, 0x20, 0x13, 0x00, 0x00,
+    0x00, 0x0C, 0x0E, 0x62, 0x72, 0x1E, 0x0C, 0x00, 0x00, 0x30, 0x03, 0x00,
+#endif // FONT_SUBSET_SYMBOLS
+#if (FONT_SUBSET & FONT_SUBSET_UPPERCASE) // 0x40~0x5f
+    0xFC, 0xFE, 0x02, 0x62, 0xF2, 0x92, 0xFE, 0xFC, 0x31, 0x22, 0x22, 0x22,
+    0x00, 0xF8, 0xFC, 0x46, 0x46, 0xFC, 0xF8, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xFE, 0xFE, 0x22, 0x22, 0xFE, 0xDC, 0x00, 0x30, 0x23, 0x32, 0x01,
+    0x00, 0xFC, 0xFE, 0x02, 0x02, 0x8E, 0x8C, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFE, 0xFE, 0x02, 0x06, 0xFC, 0xF8, 0x00, 0x30, 0x23, 0x13, 0x00,
+    0x00, 0xFE, 0xFE, 0x22, 0x22, 0x22, 0x02, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0xFE, 0xFE, 0x22, 0x22, 0x22, 0x02, 0x00, 0x30, 0x03, 0x00, 0x00,
+    0x00, 0xFC, 0xFE, 0x02, 0x42, 0xCE, 0xCC, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xFE, 0xFE, 0x20, 0x20, 0xFE, 0xFE, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0x00, 0x02, 0xFE, 0xFE, 0x02, 0x00, 0x00, 0x00, 0x32, 0x23, 0x00,
+    0x00, 0x80, 0x80, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFE, 0xFE, 0x20, 0xF8, 0xDE, 0x06, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0xFE, 0xFE, 0x08, 0x70, 0x08, 0xFE, 0xFE, 0x30, 0x03, 0x00, 0x33,
+    0x00, 0xFE, 0xFE, 0x18, 0x30, 0x60, 0xFE, 0xFE, 0x30, 0x03, 0x00, 0x33,
+    0x00, 0xFC, 0xFE, 0x02, 0x02, 0xFE, 0xFC, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFE, 0xFE, 0x22, 0x22, 0x3E, 0x1C, 0x00, 0x30, 0x03, 0x00, 0x00,
+    0x00, 0xFC, 0xFE, 0x02, 0x02, 0xFE, 0xFC, 0x00, 0x10, 0x23, 0xF6, 0x09,
+    0x00, 0xFE, 0xFE, 0x22, 0x62, 0xFE, 0x9C, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0x0C, 0x1E, 0x32, 0x62, 0xC6, 0x84, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0x02, 0x02, 0xFE, 0xFE, 0x02, 0x02, 0x00, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x31, 0x13, 0x00,
+    0x00, 0x7E, 0xFE, 0x80, 0x70, 0x80, 0xFE, 0x7E, 0x00, 0x33, 0x30, 0x03,
+    0x00, 0x86, 0xCE, 0x38, 0x70, 0xCE, 0x86, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0x1E, 0x3E, 0xE0, 0xE0, 0x3E, 0x1E, 0x00, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0x82, 0xC2, 0x62, 0x32, 0x1E, 0x0E, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0x00, 0xFF, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x88, 0x00,
+    0x00, 0x06, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x71, 0x06,
+    0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x88, 0xFF, 0x00,
+    0x00, 0x02, 0x03, 0x01, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88,
+#endif // FONT_SUBSET_UPPERCASE
+#if (FONT_SUBSET & FONT_SUBSET_LOWERCASE) // 0x60~0x7f
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xC8, 0x48, 0x48, 0xF8, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xFE, 0xFE, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0x30, 0x23, 0x32, 0x01,
+    0x00, 0xF0, 0xF8, 0x08, 0x08, 0x18, 0x10, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF0, 0xF8, 0x08, 0x08, 0xFE, 0xFE, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xF0, 0xF8, 0x48, 0x48, 0x78, 0x70, 0x00, 0x10, 0x23, 0x22, 0x00,
+    0x00, 0x20, 0xFC, 0xFE, 0x22, 0x22, 0x22, 0x00, 0x00, 0x33, 0x00, 0x00,
+    0x00, 0xF0, 0xF8, 0x08, 0x08, 0xF8, 0xF8, 0x00, 0x80, 0x99, 0xF9, 0x07,
+    0x00, 0xFE, 0xFE, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0x08, 0x08, 0xFB, 0xFB, 0x00, 0x00, 0x00, 0x20, 0x32, 0x23, 0x02,
+    0x00, 0x00, 0x08, 0x08, 0xFB, 0xFB, 0x00, 0x00, 0x80, 0x88, 0x7F, 0x00,
+    0x00, 0xFE, 0xFE, 0x40, 0xE0, 0xB8, 0x18, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0x02, 0x02, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x20, 0x32, 0x23, 0x02,
+    0x00, 0xF8, 0xF8, 0x08, 0xF8, 0x08, 0xF8, 0xF0, 0x30, 0x03, 0x01, 0x33,
+    0x00, 0xF8, 0xF8, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF0, 0xF8, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF8, 0xF8, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0xF0, 0x1F, 0x11, 0x00,
+    0x00, 0xF0, 0xF8, 0x08, 0x08, 0xF8, 0xF8, 0x00, 0x00, 0x11, 0xF1, 0x0F,
+    0x00, 0xF8, 0xF8, 0x20, 0x10, 0x18, 0x18, 0x00, 0x30, 0x03, 0x00, 0x00,
+    0x00, 0x30, 0x78, 0x48, 0x48, 0xC8, 0x88, 0x00, 0x20, 0x22, 0x32, 0x01,
+    0x00, 0x08, 0xFE, 0xFE, 0x08, 0x08, 0x08, 0x00, 0x00, 0x31, 0x22, 0x02,
+    0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x00, 0x31, 0x13, 0x00,
+    0x00, 0xF8, 0xF8, 0x00, 0xF0, 0x00, 0xF8, 0xF8, 0x00, 0x33, 0x30, 0x03,
+    0x00, 0x18, 0xB8, 0xE0, 0xE0, 0xB8, 0x18, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF8, 0xF8, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x80, 0xD9, 0x3F, 0x00,
+    0x00, 0x08, 0x88, 0xC8, 0x68, 0x38, 0x18, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0x20, 0x70, 0xDE, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x30, 0x47, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0x00, 0x00, 0x01, 0x8F, 0xDE, 0x70, 0x20, 0x00, 0x00, 0x74, 0x03, 0x00,
+    0x0C, 0x06, 0x02, 0x06, 0x0C, 0x08, 0x0C, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x30, 0x33, 0x33, 0x03,
+#endif // FONT_SUBSET_LOWERCASE
+#if (FONT_SUBSET & FONT_SUBSET_EXTENDED) // 0x80~0x9f
+    0x00, 0x50, 0xFC, 0xFE, 0x52, 0x02, 0x04, 0x00, 0x00, 0x31, 0x22, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xB0, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+    0x00, 0x18, 0x18, 0xFE, 0xFE, 0x18, 0x18, 0x00, 0x00, 0x70, 0x07, 0x00,
+    0x00, 0x98, 0x98, 0xFE, 0xFE, 0x98, 0x98, 0x00, 0x10, 0x71, 0x17, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0E, 0x0A, 0x8E, 0x60, 0x18, 0x06, 0x00, 0x00, 0x16, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0xFC, 0x02, 0x02, 0xFE, 0x22, 0x02, 0x00, 0x30, 0x44, 0x47, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0E, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0B, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0E, 0x0D, 0x00, 0x0E, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0B, 0x07, 0x00, 0x0B, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xF0, 0xF0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x04, 0x02, 0x02, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x0F, 0x01, 0x00, 0x0F, 0x02, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+#endif // FONT_SUBSET_EXTENDED
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_A0) // 0xa0~0xbf
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xD8, 0xD8, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x7F, 0x00,
+    0x00, 0xF0, 0xF8, 0x0E, 0x0E, 0x98, 0x90, 0x00, 0x00, 0x71, 0x17, 0x00,
+    0x20, 0xFC, 0xFE, 0x22, 0x22, 0x26, 0x04, 0x00, 0x33, 0x22, 0x22, 0x02,
+    0x00, 0xB4, 0xFC, 0x48, 0x48, 0xFC, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xAE, 0xBE, 0xF0, 0xF0, 0xBE, 0xAE, 0x00, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00,
+    0x00, 0x66, 0xFF, 0x99, 0x99, 0xF3, 0x62, 0x00, 0x40, 0x9C, 0xF9, 0x06,
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x06, 0x72, 0x8A, 0x8A, 0x52, 0x06, 0xFC, 0x31, 0x22, 0x22, 0x13,
+    0x00, 0x90, 0xBA, 0xAA, 0xAA, 0xBE, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xC0, 0x60, 0x20, 0x80, 0xC0, 0x60, 0x20, 0x10, 0x23, 0x10, 0x23,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x06, 0xFA, 0x4A, 0x4A, 0xB2, 0x06, 0xFC, 0x31, 0x22, 0x22, 0x13,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x0F, 0x09, 0x09, 0x0F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0xF8, 0xF8, 0x20, 0x20, 0x00, 0x20, 0x22, 0x22, 0x02,
+    0x00, 0x00, 0x32, 0x3A, 0x2E, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x2A, 0x3E, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFC, 0xFC, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0xF8, 0x17, 0x01, 0x11,
+    0x00, 0x1C, 0x3E, 0x7F, 0x7F, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F,
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x4E, 0x00,
+    0x00, 0x00, 0x04, 0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9C, 0xBE, 0xA2, 0xA2, 0xBE, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x60, 0xC0, 0x80, 0x20, 0x60, 0xC0, 0x80, 0x32, 0x01, 0x32, 0x01,
+    0x02, 0x9F, 0xDF, 0x60, 0xB0, 0xD8, 0xCC, 0xC4, 0x11, 0x30, 0x23, 0x77,
+    0x02, 0x9F, 0xDF, 0x60, 0x70, 0x58, 0xCC, 0x84, 0x11, 0x00, 0x76, 0x45,
+    0x11, 0x95, 0xDF, 0x6A, 0xB0, 0xD8, 0xCC, 0xC4, 0x11, 0x30, 0x23, 0x77,
+    0x00, 0x00, 0x00, 0xD8, 0xD8, 0x00, 0x00, 0x00, 0x60, 0x9F, 0xE8, 0x06,
+#endif // FONT_SUBSET_LATIN1_A0
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_C0) // 0xc0~0xdf
+    0x00, 0xF8, 0xFD, 0x47, 0x46, 0xFC, 0xF8, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF8, 0xFC, 0x46, 0x47, 0xFD, 0xF8, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF8, 0xFD, 0x47, 0x47, 0xFD, 0xF8, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF2, 0xF9, 0x4D, 0x4E, 0xFA, 0xF1, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF8, 0xFD, 0x46, 0x46, 0xFD, 0xF8, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF0, 0xFA, 0x4D, 0x4D, 0xFA, 0xF0, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF0, 0xF8, 0x4C, 0xFE, 0xFE, 0x22, 0x22, 0x30, 0x03, 0x33, 0x22,
+    0x00, 0xFC, 0xFE, 0x02, 0x02, 0xCE, 0xCC, 0x00, 0x00, 0xB9, 0x5F, 0x00,
+    0x00, 0xFC, 0xFD, 0x25, 0x24, 0x24, 0x04, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0xFC, 0xFC, 0x24, 0x25, 0x25, 0x04, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0xFC, 0xFD, 0x25, 0x25, 0x25, 0x04, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0xFC, 0xFD, 0x24, 0x24, 0x25, 0x04, 0x00, 0x30, 0x23, 0x22, 0x02,
+    0x00, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x32, 0x23, 0x00,
+    0x00, 0x00, 0x04, 0xFC, 0xFD, 0x05, 0x00, 0x00, 0x00, 0x32, 0x23, 0x00,
+    0x00, 0x00, 0x05, 0xFD, 0xFD, 0x05, 0x00, 0x00, 0x00, 0x32, 0x23, 0x00,
+    0x00, 0x00, 0x05, 0xFC, 0xFC, 0x05, 0x00, 0x00, 0x00, 0x32, 0x23, 0x00,
+    0x20, 0xFE, 0xFE, 0x22, 0x06, 0xFC, 0xF8, 0x00, 0x30, 0x23, 0x13, 0x00,
+    0x00, 0xFA, 0xF9, 0x31, 0x62, 0xC2, 0xF9, 0xF8, 0x30, 0x03, 0x00, 0x33,
+    0x00, 0xF8, 0xFD, 0x05, 0x04, 0xFC, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF8, 0xFC, 0x04, 0x05, 0xFD, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF8, 0xFD, 0x05, 0x05, 0xFD, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF8, 0xFD, 0x05, 0x05, 0xFD, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF8, 0xFD, 0x04, 0x04, 0xFD, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0x8C, 0xD8, 0x70, 0x70, 0xD8, 0x8C, 0x00, 0x10, 0x00, 0x00, 0x01,
+    0x00, 0xFC, 0xFE, 0xE2, 0x3A, 0xFE, 0xFE, 0x00, 0x30, 0x23, 0x32, 0x01,
+    0x00, 0xFC, 0xFD, 0x01, 0x00, 0xFC, 0xFC, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFC, 0xFC, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFC, 0xFD, 0x01, 0x01, 0xFD, 0xFC, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFC, 0xFD, 0x00, 0x00, 0xFD, 0xFC, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0x1C, 0x3C, 0xE0, 0xE1, 0x3D, 0x1C, 0x00, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0xFE, 0xFE, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x30, 0x03, 0x00, 0x00,
+    0x00, 0xFC, 0xFE, 0x02, 0x1E, 0xFC, 0xE0, 0x00, 0x30, 0x03, 0x32, 0x01,
+#endif // FONT_SUBSET_LATIN1_C0
+#if (FONT_SUBSET & FONT_SUBSET_LATIN1_E0) // 0xe0~0xff
+    0x00, 0x80, 0xC9, 0x4B, 0x4A, 0xF8, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0x80, 0xC8, 0x4A, 0x4B, 0xF9, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0x80, 0xCA, 0x49, 0x49, 0xFA, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0x82, 0xC9, 0x49, 0x4A, 0xFA, 0xF1, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0x83, 0xCB, 0x48, 0x48, 0xFB, 0xF3, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0x80, 0xD2, 0x55, 0x55, 0xF2, 0xE0, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x80, 0xC8, 0x48, 0xF0, 0xF8, 0x48, 0x78, 0x70, 0x31, 0x32, 0x21, 0x22,
+    0x00, 0xF0, 0xF8, 0x08, 0x08, 0x18, 0x10, 0x00, 0x10, 0xAB, 0x3E, 0x01,
+    0x00, 0xF0, 0xF9, 0x4B, 0x4A, 0x78, 0x70, 0x00, 0x10, 0x23, 0x22, 0x00,
+    0x00, 0xF0, 0xF8, 0x4A, 0x4B, 0x79, 0x70, 0x00, 0x10, 0x23, 0x22, 0x00,
+    0x00, 0xF0, 0xFA, 0x49, 0x49, 0x7A, 0x70, 0x00, 0x10, 0x23, 0x22, 0x00,
+    0x00, 0xF3, 0xFB, 0x48, 0x48, 0x7B, 0x73, 0x00, 0x10, 0x23, 0x22, 0x00,
+    0x00, 0x08, 0x09, 0xFB, 0xFA, 0x00, 0x00, 0x00, 0x20, 0x32, 0x23, 0x02,
+    0x00, 0x08, 0x08, 0xFA, 0xFB, 0x01, 0x00, 0x00, 0x20, 0x32, 0x23, 0x02,
+    0x00, 0x08, 0x0A, 0xF9, 0xF9, 0x02, 0x00, 0x00, 0x20, 0x32, 0x23, 0x02,
+    0x00, 0x0B, 0x0B, 0xF8, 0xF8, 0x03, 0x03, 0x00, 0x20, 0x32, 0x23, 0x02,
+    0x00, 0xE8, 0xEA, 0x16, 0x1C, 0xFA, 0xF2, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xFA, 0xF9, 0x09, 0x0A, 0xFA, 0xF1, 0x00, 0x30, 0x03, 0x30, 0x03,
+    0x00, 0xF0, 0xF9, 0x0B, 0x0A, 0xF8, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF0, 0xF8, 0x0A, 0x0B, 0xF9, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF0, 0xFA, 0x09, 0x09, 0xFA, 0xF0, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF2, 0xF9, 0x09, 0x0A, 0xFA, 0xF1, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0xF3, 0xFB, 0x08, 0x08, 0xFB, 0xF3, 0x00, 0x10, 0x23, 0x32, 0x01,
+    0x00, 0x20, 0x20, 0xAC, 0xAC, 0x20, 0x20, 0x00, 0x00, 0x10, 0x01, 0x00,
+    0x00, 0xF0, 0xF8, 0xC8, 0x68, 0xF8, 0xF8, 0x00, 0x30, 0x23, 0x32, 0x01,
+    0x00, 0xF8, 0xF9, 0x03, 0x02, 0xF8, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xF8, 0xF8, 0x02, 0x03, 0xF9, 0xF8, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xFA, 0xFB, 0x01, 0x01, 0xFB, 0xFA, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xFB, 0xFB, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x10, 0x23, 0x32, 0x03,
+    0x00, 0xF8, 0xF8, 0x02, 0x03, 0xF9, 0xF8, 0x00, 0x88, 0xD9, 0x37, 0x00,
+    0x00, 0xFF, 0xFF, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0xF0, 0x1F, 0x11, 0x00,
+    0x00, 0xFB, 0xFB, 0x00, 0x00, 0xFB, 0xFB, 0x00, 0x88, 0xD9, 0x37, 0x00
+#endif // FONT_SUBSET_LATIN1_E0
 };
+#endif // hV_FONT_TERMINAL_DEFINITION
 
 #endif
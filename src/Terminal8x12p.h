@@ -0,0 +1,301 @@
+///
+/// @file Terminal8x12p.h
+/// @brief Proportional font Terminal8x12p
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+/// @n Generated by extras/bdf2pdls.py from Terminal8x12e.h
+/// @n Height 12, maximum width 8, 2 bytes per column, 1273 columns
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+
+#ifndef TERMINAL8X12P_FONT_RELEASE
+///
+/// @brief Release
+///
+#define TERMINAL8X12P_FONT_RELEASE 830
+
+///
+/// @brief Maximum width of Terminal8x12p, in pixels
+///
+#define TERMINAL8X12P_MAX_WIDTH 8
+
+extern const uint16_t Terminal8x12p_column[225];
+extern const uint8_t Terminal8x12p_table[2546];
+extern const font_s Terminal8x12p_font;
+
+#if defined(hV_FONT_TERMINAL_DEFINITION)
+///
+/// @brief First column of each character, last = total
+///
+const uint16_t Terminal8x12p_column[225] =
+{
+    0, 4, 8, 14, 21, 27, 35, 42, 44, 48, 52, 59, 65, 68, 74, 77,
+    83, 90, 97, 104, 111, 118, 125, 132, 139, 146, 153, 156, 159, 165, 171, 177,
+    183, 191, 197, 203, 209, 215, 221, 227, 233, 239, 243, 249, 255, 261, 268, 275,
+    281, 287, 293, 299, 305, 311, 317, 323, 330, 336, 342, 348, 352, 358, 362, 368,
+    376, 379, 385, 391, 397, 403, 409, 415, 421, 427, 433, 438, 444, 450, 457, 463,
+    469, 475, 481, 487, 493, 499, 505, 511, 518, 524, 530, 536, 541, 543, 548, 556,
+    562, 568, 572, 574, 578, 583, 588, 594, 600, 604, 610, 614, 616, 622, 626, 630,
+    634, 638, 640, 642, 647, 652, 656, 660, 666, 672, 679, 683, 685, 689, 693, 697,
+    701, 705, 709, 715, 722, 728, 734, 736, 742, 748, 756, 762, 770, 776, 782, 790,
+    798, 804, 810, 814, 818, 821, 829, 836, 839, 843, 846, 852, 860, 868, 876, 884,
+    890, 896, 902, 908, 914, 920, 926, 933, 939, 945, 951, 957, 963, 967, 971, 975,
+    979, 986, 993, 999, 1005, 1011, 1017, 1023, 1029, 1035, 1041, 1047, 1053, 1059, 1065, 1071,
+    1077, 1083, 1089, 1095, 1101, 1107, 1113, 1121, 1127, 1133, 1139, 1145, 1151, 1157, 1163, 1169,
+    1175, 1181, 1187, 1193, 1199, 1205, 1211, 1217, 1223, 1229, 1235, 1241, 1247, 1253, 1260, 1266,
+    1273
+};
+
+///
+/// @brief Columns of the characters
+///
+const uint8_t Terminal8x12p_table[2546] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x20
+    0x1C, 0x00, 0x7E, 0x03, 0x7E, 0x03, 0x1C, 0x00, // 0x21
+    0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0E, 0x00, // 0x22
+    0x88, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x88, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x88, 0x00, // 0x23
+    0x0C, 0x01, 0x1E, 0x03, 0x33, 0x0E, 0x63, 0x0E, 0xC6, 0x03, 0x84, 0x01, // 0x24
+    0x06, 0x00, 0x8F, 0x01, 0xC9, 0x00, 0x6F, 0x03, 0xB6, 0x07, 0x98, 0x04, 0x8C, 0x07, 0x00, 0x03, // 0x25
+    0xEC, 0x01, 0xFE, 0x03, 0x12, 0x02, 0x5E, 0x02, 0xCC, 0x01, 0xC0, 0x03, 0x40, 0x02, // 0x26
+    0x0E, 0x00, 0x0E, 0x00, // 0x27
+    0xF8, 0x00, 0xFE, 0x03, 0x07, 0x07, 0x01, 0x04, // 0x28
+    0x01, 0x04, 0x07, 0x07, 0xFE, 0x03, 0xF8, 0x00, // 0x29
+    0x20, 0x00, 0xA8, 0x00, 0xF8, 0x00, 0x70, 0x00, 0xF8, 0x00, 0xA8, 0x00, 0x20, 0x00, // 0x2a
+    0x20, 0x00, 0x20, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x20, 0x00, 0x20, 0x00, // 0x2b
+    0x00, 0x0B, 0x00, 0x0F, 0x00, 0x07, // 0x2c
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, // 0x2d
+    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, // 0x2e
+    0x00, 0x03, 0xC0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0x00, // 0x2f
+    0xFC, 0x01, 0xFE, 0x03, 0xC2, 0x02, 0x1A, 0x02, 0xFE, 0x03, 0xFC, 0x01, 0x00, 0x00, // 0x30
+    0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x0C, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x00, // 0x31
+    0x0C, 0x03, 0x8E, 0x03, 0xC2, 0x02, 0x62, 0x02, 0x3E, 0x02, 0x1C, 0x02, 0x00, 0x00, // 0x32
+    0x8C, 0x01, 0x8E, 0x03, 0x22, 0x02, 0x22, 0x02, 0xFE, 0x03, 0xDC, 0x01, 0x00, 0x00, // 0x33
+    0xC0, 0x00, 0xFE, 0x00, 0xBE, 0x00, 0x80, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x80, 0x00, // 0x34
+    0x3E, 0x02, 0x3E, 0x02, 0x22, 0x02, 0x22, 0x03, 0xE2, 0x01, 0xC2, 0x00, 0x00, 0x00, // 0x35
+    0xF0, 0x01, 0xF8, 0x03, 0x1E, 0x02, 0x16, 0x02, 0xF2, 0x03, 0xE0, 0x01, 0x00, 0x00, // 0x36
+    0x02, 0x00, 0x82, 0x03, 0xE2, 0x03, 0x7A, 0x00, 0x1E, 0x00, 0x06, 0x00, 0x00, 0x00, // 0x37
+    0xDC, 0x01, 0xFE, 0x03, 0x32, 0x02, 0x62, 0x02, 0xFE, 0x03, 0xDC, 0x01, 0x00, 0x00, // 0x38
+    0x3C, 0x00, 0x7E, 0x02, 0x42, 0x03, 0xC2, 0x03, 0xFE, 0x00, 0x7C, 0x00, 0x00, 0x00, // 0x39
+    0x18, 0x03, 0x18, 0x03, 0x18, 0x03, // 0x3a
+    0x18, 0x0B, 0x18, 0x0F, 0x18, 0x07, // 0x3b
+    0x20, 0x00, 0x70, 0x00, 0xD8, 0x00, 0x8C, 0x01, 0x06, 0x03, 0x02, 0x02, // 0x3c
+    0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, // 0x3d
+    0x02, 0x02, 0x06, 0x03, 0x8C, 0x01, 0xD8, 0x00, 0x70, 0x00, 0x20, 0x00, // 0x3e
+    0x0C, 0x00, 0x0E, 0x00, 0x62, 0x03, 0x72, 0x03, 0x1E, 0x00, 0x0C, 0x00, // 0x3f
+    0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x62, 0x02, 0xF2, 0x02, 0x92, 0x02, 0xFE, 0x02, 0xFC, 0x02, // 0x40
+    0xF8, 0x03, 0xFC, 0x03, 0x46, 0x00, 0x46, 0x00, 0xFC, 0x03, 0xF8, 0x03, // 0x41
+    0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x22, 0x02, 0xFE, 0x03, 0xDC, 0x01, // 0x42
+    0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x02, 0x02, 0x8E, 0x03, 0x8C, 0x01, // 0x43
+    0xFE, 0x03, 0xFE, 0x03, 0x02, 0x02, 0x06, 0x03, 0xFC, 0x01, 0xF8, 0x00, // 0x44
+    0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x02, 0x02, // 0x45
+    0xFE, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, 0x02, 0x00, // 0x46
+    0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x42, 0x02, 0xCE, 0x03, 0xCC, 0x03, // 0x47
+    0xFE, 0x03, 0xFE, 0x03, 0x20, 0x00, 0x20, 0x00, 0xFE, 0x03, 0xFE, 0x03, // 0x48
+    0x02, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0x02, 0x02, // 0x49
+    0x80, 0x01, 0x80, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFE, 0x03, 0xFE, 0x01, // 0x4a
+    0xFE, 0x03, 0xFE, 0x03, 0x20, 0x00, 0xF8, 0x00, 0xDE, 0x03, 0x06, 0x03, // 0x4b
+    0xFE, 0x03, 0xFE, 0x03, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, // 0x4c
+    0xFE, 0x03, 0xFE, 0x03, 0x08, 0x00, 0x70, 0x00, 0x08, 0x00, 0xFE, 0x03, 0xFE, 0x03, // 0x4d
+    0xFE, 0x03, 0xFE, 0x03, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xFE, 0x03, 0xFE, 0x03, // 0x4e
+    0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x02, 0x02, 0xFE, 0x03, 0xFC, 0x01, // 0x4f
+    0xFE, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x22, 0x00, 0x3E, 0x00, 0x1C, 0x00, // 0x50
+    0xFC, 0x01, 0xFE, 0x03, 0x02, 0x02, 0x02, 0x06, 0xFE, 0x0F, 0xFC, 0x09, // 0x51
+    0xFE, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x62, 0x00, 0xFE, 0x03, 0x9C, 0x03, // 0x52
+    0x0C, 0x01, 0x1E, 0x03, 0x32, 0x02, 0x62, 0x02, 0xC6, 0x03, 0x84, 0x01, // 0x53
+    0x02, 0x00, 0x02, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x02, 0x00, 0x02, 0x00, // 0x54
+    0xFE, 0x01, 0xFE, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFE, 0x03, 0xFE, 0x01, // 0x55
+    0xFE, 0x00, 0xFE, 0x01, 0x00, 0x03, 0x00, 0x03, 0xFE, 0x01, 0xFE, 0x00, // 0x56
+    0x7E, 0x00, 0xFE, 0x03, 0x80, 0x03, 0x70, 0x00, 0x80, 0x03, 0xFE, 0x03, 0x7E, 0x00, // 0x57
+    0x86, 0x03, 0xCE, 0x03, 0x38, 0x00, 0x70, 0x00, 0xCE, 0x03, 0x86, 0x03, // 0x58
+    0x1E, 0x00, 0x3E, 0x00, 0xE0, 0x03, 0xE0, 0x03, 0x3E, 0x00, 0x1E, 0x00, // 0x59
+    0x82, 0x03, 0xC2, 0x03, 0x62, 0x02, 0x32, 0x02, 0x1E, 0x02, 0x0E, 0x02, // 0x5a
+    0xFF, 0x0F, 0xFF, 0x0F, 0x01, 0x08, 0x01, 0x08, // 0x5b
+    0x06, 0x00, 0x1E, 0x00, 0x78, 0x00, 0xE0, 0x01, 0x80, 0x07, 0x00, 0x06, // 0x5c
+    0x01, 0x08, 0x01, 0x08, 0xFF, 0x0F, 0xFF, 0x0F, // 0x5d
+    0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, // 0x5e
+    0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, // 0x5f
+    0x01, 0x00, 0x03, 0x00, 0x02, 0x00, // 0x60
+    0x80, 0x01, 0xC8, 0x03, 0x48, 0x02, 0x48, 0x02, 0xF8, 0x03, 0xF0, 0x03, // 0x61
+    0xFE, 0x03, 0xFE, 0x03, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x03, 0xF0, 0x01, // 0x62
+    0xF0, 0x01, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, 0x18, 0x03, 0x10, 0x01, // 0x63
+    0xF0, 0x01, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, 0xFE, 0x03, 0xFE, 0x03, // 0x64
+    0xF0, 0x01, 0xF8, 0x03, 0x48, 0x02, 0x48, 0x02, 0x78, 0x02, 0x70, 0x00, // 0x65
+    0x20, 0x00, 0xFC, 0x03, 0xFE, 0x03, 0x22, 0x00, 0x22, 0x00, 0x22, 0x00, // 0x66
+    0xF0, 0x08, 0xF8, 0x09, 0x08, 0x09, 0x08, 0x09, 0xF8, 0x0F, 0xF8, 0x07, // 0x67
+    0xFE, 0x03, 0xFE, 0x03, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x03, 0xF0, 0x03, // 0x68
+    0x08, 0x02, 0x08, 0x02, 0xFB, 0x03, 0xFB, 0x03, 0x00, 0x02, 0x00, 0x02, // 0x69
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0xFB, 0x0F, 0xFB, 0x07, // 0x6a
+    0xFE, 0x03, 0xFE, 0x03, 0x40, 0x00, 0xE0, 0x00, 0xB8, 0x03, 0x18, 0x03, // 0x6b
+    0x02, 0x02, 0x02, 0x02, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x02, 0x00, 0x02, // 0x6c
+    0xF8, 0x03, 0xF8, 0x03, 0x08, 0x00, 0xF8, 0x01, 0x08, 0x00, 0xF8, 0x03, 0xF0, 0x03, // 0x6d
+    0xF8, 0x03, 0xF8, 0x03, 0x08, 0x00, 0x08, 0x00, 0xF8, 0x03, 0xF0, 0x03, // 0x6e
+    0xF0, 0x01, 0xF8, 0x03, 0x08, 0x02, 0x08, 0x02, 0xF8, 0x03, 0xF0, 0x01, // 0x6f
+    0xF8, 0x0F, 0xF8, 0x0F, 0x08, 0x01, 0x08, 0x01, 0xF8, 0x01, 0xF0, 0x00, // 0x70
+    0xF0, 0x00, 0xF8, 0x01, 0x08, 0x01, 0x08, 0x01, 0xF8, 0x0F, 0xF8, 0x0F, // 0x71
+    0xF8, 0x03, 0xF8, 0x03, 0x20, 0x00, 0x10, 0x00, 0x18, 0x00, 0x18, 0x00, // 0x72
+    0x30, 0x02, 0x78, 0x02, 0x48, 0x02, 0x48, 0x02, 0xC8, 0x03, 0x88, 0x01, // 0x73
+    0x08, 0x00, 0xFE, 0x01, 0xFE, 0x03, 0x08, 0x02, 0x08, 0x02, 0x08, 0x02, // 0x74
+    0xF8, 0x01, 0xF8, 0x03, 0x00, 0x02, 0x00, 0x02, 0xF8, 0x03, 0xF8, 0x03, // 0x75
+    0xF8, 0x00, 0xF8, 0x01, 0x00, 0x03, 0x00, 0x03, 0xF8, 0x01, 0xF8, 0x00, // 0x76
+    0xF8, 0x00, 0xF8, 0x03, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x03, 0xF8, 0x03, 0xF8, 0x00, // 0x77
+    0x18, 0x03, 0xB8, 0x03, 0xE0, 0x00, 0xE0, 0x00, 0xB8, 0x03, 0x18, 0x03, // 0x78
+    0xF8, 0x08, 0xF8, 0x09, 0x00, 0x0D, 0x00, 0x0F, 0xF8, 0x03, 0xF8, 0x00, // 0x79
+    0x08, 0x03, 0x88, 0x03, 0xC8, 0x02, 0x68, 0x02, 0x38, 0x02, 0x18, 0x02, // 0x7a
+    0x20, 0x00, 0x70, 0x00, 0xDE, 0x03, 0x8F, 0x07, 0x01, 0x04, // 0x7b
+    0xFF, 0x0F, 0xFF, 0x0F, // 0x7c
+    0x01, 0x04, 0x8F, 0x07, 0xDE, 0x03, 0x70, 0x00, 0x20, 0x00, // 0x7d
+    0x0C, 0x00, 0x06, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x06, 0x00, // 0x7e
+    0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0xFE, 0x03, // 0x7f
+    0x50, 0x00, 0xFC, 0x01, 0xFE, 0x03, 0x52, 0x02, 0x02, 0x02, 0x04, 0x01, // 0x80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x81
+    0x00, 0x0B, 0x00, 0x07, // 0x82
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x83
+    0x00, 0x0B, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, // 0x84
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, // 0x85
+    0x18, 0x00, 0x18, 0x00, 0xFE, 0x07, 0xFE, 0x07, 0x18, 0x00, 0x18, 0x00, // 0x86
+    0x98, 0x01, 0x98, 0x01, 0xFE, 0x07, 0xFE, 0x07, 0x98, 0x01, 0x98, 0x01, // 0x87
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x88
+    0x0E, 0x00, 0x0A, 0x06, 0x8E, 0x01, 0x60, 0x04, 0x18, 0x00, 0x06, 0x04, // 0x89
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8a
+    0x80, 0x00, 0x40, 0x01, // 0x8b
+    0xFC, 0x03, 0x02, 0x04, 0x02, 0x04, 0xFE, 0x07, 0x22, 0x04, 0x02, 0x04, // 0x8c
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8e
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x8f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x90
+    0x0E, 0x00, 0x0D, 0x00, // 0x91
+    0x0B, 0x00, 0x07, 0x00, // 0x92
+    0x0E, 0x00, 0x0D, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, // 0x93
+    0x0B, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x07, 0x00, // 0x94
+    0x60, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x60, 0x00, // 0x95
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, // 0x96
+    0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, // 0x97
+    0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, // 0x98
+    0x01, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x0F, 0x00, // 0x99
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9a
+    0x40, 0x01, 0x80, 0x00, // 0x9b
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9c
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9d
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9e
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x9f
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xa0
+    0x00, 0x07, 0xD8, 0x0F, 0xD8, 0x0F, 0x00, 0x07, // 0xa1
+    0xF0, 0x00, 0xF8, 0x01, 0x0E, 0x07, 0x0E, 0x07, 0x98, 0x01, 0x90, 0x00, // 0xa2
+    0x20, 0x03, 0xFC, 0x03, 0xFE, 0x02, 0x22, 0x02, 0x22, 0x02, 0x26, 0x02, 0x04, 0x02, // 0xa3
+    0xB4, 0x00, 0xFC, 0x00, 0x48, 0x00, 0x48, 0x00, 0xFC, 0x00, 0xB4, 0x00, // 0xa4
+    0xAE, 0x00, 0xBE, 0x00, 0xF0, 0x03, 0xF0, 0x03, 0xBE, 0x00, 0xAE, 0x00, // 0xa5
+    0x3E, 0x0F, 0x3E, 0x0F, // 0xa6
+    0x66, 0x04, 0xFF, 0x0C, 0x99, 0x09, 0x99, 0x09, 0xF3, 0x0F, 0x62, 0x06, // 0xa7
+    0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, // 0xa8
+    0xFC, 0x01, 0x06, 0x03, 0x72, 0x02, 0x8A, 0x02, 0x8A, 0x02, 0x52, 0x02, 0x06, 0x03, 0xFC, 0x01, // 0xa9
+    0x90, 0x00, 0xBA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xBE, 0x00, 0xBC, 0x00, // 0xaa
+    0x80, 0x00, 0xC0, 0x01, 0x60, 0x03, 0x20, 0x02, 0x80, 0x00, 0xC0, 0x01, 0x60, 0x03, 0x20, 0x02, // 0xab
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0xE0, 0x00, 0xE0, 0x00, // 0xac
+    0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, // 0xad
+    0xFC, 0x01, 0x06, 0x03, 0xFA, 0x02, 0x4A, 0x02, 0x4A, 0x02, 0xB2, 0x02, 0x06, 0x03, 0xFC, 0x01, // 0xae
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, // 0xaf
+    0x06, 0x00, 0x0F, 0x00, 0x09, 0x00, 0x09, 0x00, 0x0F, 0x00, 0x06, 0x00, // 0xb0
+    0x20, 0x02, 0x20, 0x02, 0xF8, 0x02, 0xF8, 0x02, 0x20, 0x02, 0x20, 0x02, // 0xb1
+    0x32, 0x00, 0x3A, 0x00, 0x2E, 0x00, 0x24, 0x00, // 0xb2
+    0x22, 0x00, 0x2A, 0x00, 0x3E, 0x00, 0x14, 0x00, // 0xb3
+    0x02, 0x00, 0x03, 0x00, 0x01, 0x00, // 0xb4
+    0x00, 0x08, 0xFC, 0x0F, 0xFC, 0x07, 0x00, 0x01, 0x00, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0x00, 0x01, // 0xb5
+    0x1C, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0x01, 0x00, // 0xb6
+    0x30, 0x00, 0x30, 0x00, 0x30, 0x00, // 0xb7
+    0x00, 0x08, 0x00, 0x0A, 0x00, 0x0E, 0x00, 0x04, // 0xb8
+    0x04, 0x00, 0x3E, 0x00, 0x3E, 0x00, // 0xb9
+    0x9C, 0x00, 0xBE, 0x00, 0xA2, 0x00, 0xA2, 0x00, 0xBE, 0x00, 0x9C, 0x00, // 0xba
+    0x20, 0x02, 0x60, 0x03, 0xC0, 0x01, 0x80, 0x00, 0x20, 0x02, 0x60, 0x03, 0xC0, 0x01, 0x80, 0x00, // 0xbb
+    0x02, 0x01, 0x9F, 0x01, 0xDF, 0x00, 0x60, 0x03, 0xB0, 0x03, 0xD8, 0x02, 0xCC, 0x07, 0xC4, 0x07, // 0xbc
+    0x02, 0x01, 0x9F, 0x01, 0xDF, 0x00, 0x60, 0x00, 0x70, 0x06, 0x58, 0x07, 0xCC, 0x05, 0x84, 0x04, // 0xbd
+    0x11, 0x01, 0x95, 0x01, 0xDF, 0x00, 0x6A, 0x03, 0xB0, 0x03, 0xD8, 0x02, 0xCC, 0x07, 0xC4, 0x07, // 0xbe
+    0x00, 0x06, 0x00, 0x0F, 0xD8, 0x09, 0xD8, 0x08, 0x00, 0x0E, 0x00, 0x06, // 0xbf
+    0xF8, 0x03, 0xFD, 0x03, 0x47, 0x00, 0x46, 0x00, 0xFC, 0x03, 0xF8, 0x03, // 0xc0
+    0xF8, 0x03, 0xFC, 0x03, 0x46, 0x00, 0x47, 0x00, 0xFD, 0x03, 0xF8, 0x03, // 0xc1
+    0xF8, 0x03, 0xFD, 0x03, 0x47, 0x00, 0x47, 0x00, 0xFD, 0x03, 0xF8, 0x03, // 0xc2
+    0xF2, 0x03, 0xF9, 0x03, 0x4D, 0x00, 0x4E, 0x00, 0xFA, 0x03, 0xF1, 0x03, // 0xc3
+    0xF8, 0x03, 0xFD, 0x03, 0x46, 0x00, 0x46, 0x00, 0xFD, 0x03, 0xF8, 0x03, // 0xc4
+    0xF0, 0x03, 0xFA, 0x03, 0x4D, 0x00, 0x4D, 0x00, 0xFA, 0x03, 0xF0, 0x03, // 0xc5
+    0xF0, 0x03, 0xF8, 0x03, 0x4C, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x22, 0x02, // 0xc6
+    0xFC, 0x00, 0xFE, 0x09, 0x02, 0x0B, 0x02, 0x0F, 0xCE, 0x05, 0xCC, 0x00, // 0xc7
+    0xFC, 0x03, 0xFD, 0x03, 0x25, 0x02, 0x24, 0x02, 0x24, 0x02, 0x04, 0x02, // 0xc8
+    0xFC, 0x03, 0xFC, 0x03, 0x24, 0x02, 0x25, 0x02, 0x25, 0x02, 0x04, 0x02, // 0xc9
+    0xFC, 0x03, 0xFD, 0x03, 0x25, 0x02, 0x25, 0x02, 0x25, 0x02, 0x04, 0x02, // 0xca
+    0xFC, 0x03, 0xFD, 0x03, 0x24, 0x02, 0x24, 0x02, 0x25, 0x02, 0x04, 0x02, // 0xcb
+    0x01, 0x02, 0xFD, 0x03, 0xFC, 0x03, 0x00, 0x02, // 0xcc
+    0x04, 0x02, 0xFC, 0x03, 0xFD, 0x03, 0x05, 0x02, // 0xcd
+    0x05, 0x02, 0xFD, 0x03, 0xFD, 0x03, 0x05, 0x02, // 0xce
+    0x05, 0x02, 0xFC, 0x03, 0xFC, 0x03, 0x05, 0x02, // 0xcf
+    0x20, 0x00, 0xFE, 0x03, 0xFE, 0x03, 0x22, 0x02, 0x06, 0x03, 0xFC, 0x01, 0xF8, 0x00, // 0xd0
+    0xFA, 0x03, 0xF9, 0x03, 0x31, 0x00, 0x62, 0x00, 0xC2, 0x00, 0xF9, 0x03, 0xF8, 0x03, // 0xd1
+    0xF8, 0x01, 0xFD, 0x03, 0x05, 0x02, 0x04, 0x02, 0xFC, 0x03, 0xF8, 0x01, // 0xd2
+    0xF8, 0x01, 0xFC, 0x03, 0x04, 0x02, 0x05, 0x02, 0xFD, 0x03, 0xF8, 0x01, // 0xd3
+    0xF8, 0x01, 0xFD, 0x03, 0x05, 0x02, 0x05, 0x02, 0xFD, 0x03, 0xF8, 0x01, // 0xd4
+    0xF8, 0x01, 0xFD, 0x03, 0x05, 0x02, 0x05, 0x02, 0xFD, 0x03, 0xF8, 0x01, // 0xd5
+    0xF8, 0x01, 0xFD, 0x03, 0x04, 0x02, 0x04, 0x02, 0xFD, 0x03, 0xF8, 0x01, // 0xd6
+    0x8C, 0x01, 0xD8, 0x00, 0x70, 0x00, 0x70, 0x00, 0xD8, 0x00, 0x8C, 0x01, // 0xd7
+    0xFC, 0x03, 0xFE, 0x03, 0xE2, 0x02, 0x3A, 0x02, 0xFE, 0x03, 0xFE, 0x01, // 0xd8
+    0xFC, 0x01, 0xFD, 0x03, 0x01, 0x02, 0x00, 0x02, 0xFC, 0x03, 0xFC, 0x01, // 0xd9
+    0xFC, 0x01, 0xFC, 0x03, 0x00, 0x02, 0x01, 0x02, 0xFD, 0x03, 0xFC, 0x01, // 0xda
+    0xFC, 0x01, 0xFD, 0x03, 0x01, 0x02, 0x01, 0x02, 0xFD, 0x03, 0xFC, 0x01, // 0xdb
+    0xFC, 0x01, 0xFD, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFD, 0x03, 0xFC, 0x01, // 0xdc
+    0x1C, 0x00, 0x3C, 0x00, 0xE0, 0x03, 0xE1, 0x03, 0x3D, 0x00, 0x1C, 0x00, // 0xdd
+    0xFE, 0x03, 0xFE, 0x03, 0x88, 0x00, 0x88, 0x00, 0xF8, 0x00, 0x70, 0x00, // 0xde
+    0xFC, 0x03, 0xFE, 0x03, 0x02, 0x00, 0x1E, 0x02, 0xFC, 0x03, 0xE0, 0x01, // 0xdf
+    0x80, 0x01, 0xC9, 0x03, 0x4B, 0x02, 0x4A, 0x02, 0xF8, 0x03, 0xF0, 0x03, // 0xe0
+    0x80, 0x01, 0xC8, 0x03, 0x4A, 0x02, 0x4B, 0x02, 0xF9, 0x03, 0xF0, 0x03, // 0xe1
+    0x80, 0x01, 0xCA, 0x03, 0x49, 0x02, 0x49, 0x02, 0xFA, 0x03, 0xF0, 0x03, // 0xe2
+    0x82, 0x01, 0xC9, 0x03, 0x49, 0x02, 0x4A, 0x02, 0xFA, 0x03, 0xF1, 0x03, // 0xe3
+    0x83, 0x01, 0xCB, 0x03, 0x48, 0x02, 0x48, 0x02, 0xFB, 0x03, 0xF3, 0x03, // 0xe4
+    0x80, 0x01, 0xD2, 0x03, 0x55, 0x02, 0x55, 0x02, 0xF2, 0x03, 0xE0, 0x03, // 0xe5
+    0x80, 0x01, 0xC8, 0x03, 0x48, 0x02, 0xF0, 0x03, 0xF8, 0x01, 0x48, 0x02, 0x78, 0x02, 0x70, 0x02, // 0xe6
+    0xF0, 0x01, 0xF8, 0x0B, 0x08, 0x0A, 0x08, 0x0E, 0x18, 0x03, 0x10, 0x01, // 0xe7
+    0xF0, 0x01, 0xF9, 0x03, 0x4B, 0x02, 0x4A, 0x02, 0x78, 0x02, 0x70, 0x00, // 0xe8
+    0xF0, 0x01, 0xF8, 0x03, 0x4A, 0x02, 0x4B, 0x02, 0x79, 0x02, 0x70, 0x00, // 0xe9
+    0xF0, 0x01, 0xFA, 0x03, 0x49, 0x02, 0x49, 0x02, 0x7A, 0x02, 0x70, 0x00, // 0xea
+    0xF3, 0x01, 0xFB, 0x03, 0x48, 0x02, 0x48, 0x02, 0x7B, 0x02, 0x73, 0x00, // 0xeb
+    0x08, 0x02, 0x09, 0x02, 0xFB, 0x03, 0xFA, 0x03, 0x00, 0x02, 0x00, 0x02, // 0xec
+    0x08, 0x02, 0x08, 0x02, 0xFA, 0x03, 0xFB, 0x03, 0x01, 0x02, 0x00, 0x02, // 0xed
+    0x08, 0x02, 0x0A, 0x02, 0xF9, 0x03, 0xF9, 0x03, 0x02, 0x02, 0x00, 0x02, // 0xee
+    0x0B, 0x02, 0x0B, 0x02, 0xF8, 0x03, 0xF8, 0x03, 0x03, 0x02, 0x03, 0x02, // 0xef
+    0xE8, 0x01, 0xEA, 0x03, 0x16, 0x02, 0x1C, 0x02, 0xFA, 0x03, 0xF2, 0x01, // 0xf0
+    0xFA, 0x03, 0xF9, 0x03, 0x09, 0x00, 0x0A, 0x00, 0xFA, 0x03, 0xF1, 0x03, // 0xf1
+    0xF0, 0x01, 0xF9, 0x03, 0x0B, 0x02, 0x0A, 0x02, 0xF8, 0x03, 0xF0, 0x01, // 0xf2
+    0xF0, 0x01, 0xF8, 0x03, 0x0A, 0x02, 0x0B, 0x02, 0xF9, 0x03, 0xF0, 0x01, // 0xf3
+    0xF0, 0x01, 0xFA, 0x03, 0x09, 0x02, 0x09, 0x02, 0xFA, 0x03, 0xF0, 0x01, // 0xf4
+    0xF2, 0x01, 0xF9, 0x03, 0x09, 0x02, 0x0A, 0x02, 0xFA, 0x03, 0xF1, 0x01, // 0xf5
+    0xF3, 0x01, 0xFB, 0x03, 0x08, 0x02, 0x08, 0x02, 0xFB, 0x03, 0xF3, 0x01, // 0xf6
+    0x20, 0x00, 0x20, 0x00, 0xAC, 0x01, 0xAC, 0x01, 0x20, 0x00, 0x20, 0x00, // 0xf7
+    0xF0, 0x03, 0xF8, 0x03, 0xC8, 0x02, 0x68, 0x02, 0xF8, 0x03, 0xF8, 0x01, // 0xf8
+    0xF8, 0x01, 0xF9, 0x03, 0x03, 0x02, 0x02, 0x02, 0xF8, 0x03, 0xF8, 0x03, // 0xf9
+    0xF8, 0x01, 0xF8, 0x03, 0x02, 0x02, 0x03, 0x02, 0xF9, 0x03, 0xF8, 0x03, // 0xfa
+    0xFA, 0x01, 0xFB, 0x03, 0x01, 0x02, 0x01, 0x02, 0xFB, 0x03, 0xFA, 0x03, // 0xfb
+    0xFB, 0x01, 0xFB, 0x03, 0x00, 0x02, 0x00, 0x02, 0xFB, 0x03, 0xFB, 0x03, // 0xfc
+    0x00, 0x08, 0xF8, 0x08, 0xF8, 0x09, 0x02, 0x0D, 0x03, 0x07, 0xF9, 0x03, 0xF8, 0x00, // 0xfd
+    0xFF, 0x0F, 0xFF, 0x0F, 0x08, 0x01, 0x08, 0x01, 0xF8, 0x01, 0xF0, 0x00, // 0xfe
+    0x00, 0x08, 0xFB, 0x08, 0xFB, 0x09, 0x00, 0x0D, 0x00, 0x07, 0xFB, 0x03, 0xFB, 0x00 // 0xff
+};
+
+///
+/// @brief Font for addFont()
+///
+const font_s Terminal8x12p_font =
+{
+    0x20, 12, TERMINAL8X12P_MAX_WIDTH, 32, 224, Terminal8x12p_column, Terminal8x12p_table, nullptr, 0
+};
+#endif // hV_FONT_TERMINAL_DEFINITION
+
+#endif // TERMINAL8X12P_FONT_RELEASE
@@ -0,0 +1,195 @@
+//
+// hV_Binding.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 21 Jun 2025
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence All rights reserved
+//
+// Release 830: Initial release
+//
+
+// Library header
+#include "hV_Binding.h"
+
+//
+// === Binding
+//
+hV_Binding::hV_Binding()
+{
+    m_widget = nullptr;
+    m_source = nullptr;
+    m_deadband = 0;
+    m_value = 0;
+    m_displayed = 0;
+    m_flagValue = false;
+    m_flagDisplayed = false;
+    m_received = 0;
+    m_next = nullptr;
+}
+
+void hV_Binding::setWidget(hV_Widget * widget)
+{
+    m_widget = widget;
+    m_flagDisplayed = false;
+}
+
+void hV_Binding::setSource(bindingSource_t source)
+{
+    m_source = source;
+}
+
+void hV_Binding::setDeadband(uint32_t deadband)
+{
+    m_deadband = deadband;
+}
+
+void hV_Binding::setValue(int32_t value)
+{
+    m_value = value;
+    m_flagValue = true;
+    m_received += 1;
+}
+
+int32_t hV_Binding::getDisplayed()
+{
+    return m_displayed;
+}
+
+bool hV_Binding::m_apply(bool flagForce)
+{
+    if ((m_widget == nullptr) or (m_flagValue == false))
+    {
+        return false;
+    }
+
+    if (m_flagDisplayed)
+    {
+        int64_t delta = (int64_t)m_value - m_displayed;
+        if (delta < 0)
+        {
+            delta = -delta;
+        }
+
+        if ((delta == 0) or ((flagForce == false) and (delta <= m_deadband)))
+        {
+            return false;
+        }
+    }
+
+    m_widget->setValue(m_value);
+    m_displayed = m_value;
+    m_flagDisplayed = true;
+    return true;
+}
+
+//
+// === Group
+//
+hV_BindingGroup::hV_BindingGroup(hV_Screen_Buffer * screen, hV_Widget * root)
+{
+    m_screen = screen;
+    m_root = root;
+    m_first = nullptr;
+    m_minimum = 0;
+    m_maximum = 0;
+    m_chrono = 0;
+    m_flagRefreshed = false;
+    resetStatistics();
+}
+
+void hV_BindingGroup::addBinding(hV_Binding * binding)
+{
+    binding->m_next = nullptr;
+
+    if (m_first == nullptr)
+    {
+        m_first = binding;
+    }
+    else
+    {
+        hV_Binding * last = m_first;
+        while (last->m_next != nullptr)
+        {
+            last = last->m_next;
+        }
+        last->m_next = binding;
+    }
+}
+
+void hV_BindingGroup::setInterval(uint32_t minimum, uint32_t maximum)
+{
+    m_minimum = minimum;
+    m_maximum = maximum;
+}
+
+bool hV_BindingGroup::service()
+{
+    // Sources
+    for (hV_Binding * binding = m_first; binding != nullptr; binding = binding->m_next)
+    {
+        if (binding->m_source != nullptr)
+        {
+            binding->setValue(binding->m_source());
+        }
+        m_statistics.values += binding->m_received;
+        binding->m_received = 0;
+    }
+
+    // Changes wait for the minimum interval, latest value wins
+    uint32_t now = millis();
+    if (m_flagRefreshed and (now - m_chrono < m_minimum))
+    {
+        return false;
+    }
+
+    bool flagMaximum = m_flagRefreshed and (m_maximum > 0) and (now - m_chrono >= m_maximum);
+    uint32_t changes = 0;
+    for (hV_Binding * binding = m_first; binding != nullptr; binding = binding->m_next)
+    {
+        if (binding->m_apply(flagMaximum))
+        {
+            changes += 1;
+        }
+    }
+
+    if ((changes == 0) and (flagMaximum == false))
+    {
+        return false;
+    }
+
+    // One render and one refresh for all the changes
+    m_chrono = now;
+    area_s area = m_root->render();
+    if ((area.dx == 0) or (area.dy == 0))
+    {
+        return false;
+    }
+
+    m_screen->flush();
+    m_flagRefreshed = true;
+    m_statistics.changes += changes;
+    m_statistics.refreshes += 1;
+    if (changes > 1)
+    {
+        m_statistics.batched += changes - 1;
+    }
+
+    return true;
+}
+
+bindingStatistics_s hV_BindingGroup::getStatistics()
+{
+    return m_statistics;
+}
+
+void hV_BindingGroup::resetStatistics()
+{
+    m_statistics = { 0, 0, 0, 0 };
+}
+
@@ -0,0 +1,226 @@
+///
+/// @file hV_Binding.h
+/// @brief Binding of values to widgets with deadband and batched refresh
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Values from sensors or Matter attributes linked to widgets
+/// * Deadband per binding, changes within the deadband not displayed
+/// * Minimum interval between two refreshes, changes batched into one refresh
+/// * Maximum interval between two refreshes, changes within the deadband displayed
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+// Widgets
+#include "hV_Widget.h"
+
+#ifndef hV_BINDING_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_BINDING_RELEASE 830
+
+///
+/// @brief Source of a value
+/// @return fixed-point value
+///
+typedef int32_t (* bindingSource_t)();
+
+///
+/// @brief Statistics of a binding group
+///
+struct bindingStatistics_s
+{
+    uint32_t values; ///< values received, set or read from the sources
+    uint32_t changes; ///< values set to the widgets, beyond the deadband or after the maximum interval
+    uint32_t refreshes; ///< refreshes of the screen
+    uint32_t batched; ///< changes displayed by the refresh of another change
+};
+
+// Objects
+//
+///
+/// @brief Class for binding
+/// @details Links a value to a widget, the widget is set only when the value
+/// moves beyond the deadband from the value displayed
+///
+/// @note The value is either set by the application with setValue(),
+/// eg. from a Matter attribute callback, or read from the source by hV_BindingGroup::service()
+///
+class hV_Binding
+{
+    friend class hV_BindingGroup;
+
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Binding();
+
+    ///
+    /// @brief Set the widget
+    /// @param widget widget with setValue(), eg. hV_WidgetValue or hV_WidgetBar
+    ///
+    void setWidget(hV_Widget * widget);
+
+    ///
+    /// @brief Set the source
+    /// @param source function returning the value, nullptr = none, default
+    ///
+    void setSource(bindingSource_t source = nullptr);
+
+    ///
+    /// @brief Set the deadband
+    /// @param deadband changes up to deadband not displayed, same fixed-point as the value, default = 0
+    ///
+    void setDeadband(uint32_t deadband = 0);
+
+    ///
+    /// @brief Set the value
+    /// @param value fixed-point value
+    ///
+    void setValue(int32_t value);
+
+    ///
+    /// @brief Value displayed
+    /// @return last value set to the widget
+    ///
+    int32_t getDisplayed();
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Set the widget with the value
+    /// @param flagForce true = even within the deadband
+    /// @return true if set, false otherwise
+    ///
+    bool m_apply(bool flagForce);
+
+    hV_Widget * m_widget;
+    bindingSource_t m_source;
+    uint32_t m_deadband;
+    int32_t m_value;
+    int32_t m_displayed;
+    bool m_flagValue; // value received
+    bool m_flagDisplayed; // value displayed
+    uint32_t m_received; // values received since last service()
+
+    hV_Binding * m_next;
+
+    /// @endcond
+};
+
+///
+/// @brief Class for group of bindings
+/// @details Bindings refreshed together, with one render() and one flush()
+///
+/// @n Example
+/// @code {.cpp}
+/// hV_Binding bindingTemperature;
+/// hV_BindingGroup myBindings(&myScreen, &rootPanel);
+///
+/// bindingTemperature.setWidget(&temperatureValue);
+/// bindingTemperature.setDeadband(2); // 0.2 °C
+/// myBindings.addBinding(&bindingTemperature);
+/// myBindings.setInterval(10000, 600000); // 10 s to 10 min
+///
+/// void loop()
+/// {
+///     bindingTemperature.setValue(temperature);
+///     myBindings.service();
+/// }
+/// @endcode
+///
+class hV_BindingGroup
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to refresh
+    /// @param root root of the widgets to render
+    ///
+    hV_BindingGroup(hV_Screen_Buffer * screen, hV_Widget * root);
+
+    ///
+    /// @brief Add a binding
+    /// @param binding binding, not copied
+    /// @note A binding belongs to one group only
+    ///
+    void addBinding(hV_Binding * binding);
+
+    ///
+    /// @brief Set the intervals between two refreshes
+    /// @param minimum minimum interval, ms, default = 0 = none
+    /// @param maximum maximum interval, ms, default = 0 = none
+    /// @note After the maximum interval, all the values are displayed, even within the deadband
+    ///
+    void setInterval(uint32_t minimum = 0, uint32_t maximum = 0);
+
+    ///
+    /// @brief Read the sources, set the widgets, render and refresh if needed
+    /// @return true if refreshed, false otherwise
+    /// @note Call regularly, eg. from loop()
+    ///
+    bool service();
+
+    ///
+    /// @brief Get the statistics
+    /// @return values, changes and refreshes since reset
+    ///
+    bindingStatistics_s getStatistics();
+
+    ///
+    /// @brief Reset the statistics
+    ///
+    void resetStatistics();
+
+  protected:
+    /// @cond
+    hV_Screen_Buffer * m_screen;
+    hV_Widget * m_root;
+    hV_Binding * m_first;
+    uint32_t m_minimum, m_maximum;
+    uint32_t m_chrono; // last refresh, ms
+    bool m_flagRefreshed; // false = no refresh yet
+    bindingStatistics_s m_statistics;
+    /// @endcond
+};
+
+#endif // hV_BINDING_RELEASE
+
@@ -15,6 +15,9 @@
 // Release 801: Improved double-panel screen management
 // Release 804: Improved power management
 // Release 810: Added support for EXT4
+// Release 830: Added data sent by blocks
+// Release 830: Added cached GPIO configuration and power statistics
+// Release 830: Added time for busy
 //
 
 // Library header
@@ -23,6 +26,10 @@
 hV_Board::hV_Board()
 {
     b_fsmPowerScreen = FSM_OFF;
+    b_flagConfigured = false;
+    b_flagWarm = false;
+    b_timeBusy = 0;
+    resetPowerStatistics();
 }
 
 void hV_Board::b_begin(pins_t board, uint8_t family, uint16_t delayCS)
@@ -30,7 +37,52 @@ void hV_Board::b_begin(pins_t board, uint8_t family, uint16_t delayCS)
     b_pin = board;
     b_family = family;
     b_delayCS = delayCS;
-    b_fsmPowerScreen = FSM_OFF;
+    b_setFsm(FSM_OFF);
+    b_flagConfigured = false; // Pins may have changed
+}
+
+void hV_Board::b_setFsm(uint8_t state)
+{
+    uint32_t chrono = millis();
+    uint32_t elapsed = chrono - b_chronoFsm;
+
+    switch (b_fsmPowerScreen)
+    {
+        case FSM_ON:
+
+            b_statistics.timeOn += elapsed;
+            break;
+
+        case FSM_SLEEP:
+
+            b_statistics.timeSleep += elapsed;
+            break;
+
+        case FSM_GPIO_MASK:
+
+            b_statistics.timeGPIO += elapsed;
+            break;
+
+        default:
+
+            b_statistics.timeOff += elapsed;
+            break;
+    }
+
+    b_chronoFsm = chrono;
+    b_fsmPowerScreen = state;
+}
+
+powerStatistics_s hV_Board::getPowerStatistics()
+{
+    b_setFsm(b_fsmPowerScreen); // Time in current state
+    return b_statistics;
+}
+
+void hV_Board::resetPowerStatistics()
+{
+    memset(&b_statistics, 0x00, sizeof(b_statistics));
+    b_chronoFsm = millis();
 }
 
 void hV_Board::setPanelPowerPin(uint8_t panelPowerPin)
@@ -53,23 +105,32 @@ void hV_Board::b_reset(uint32_t ms1, uint32_t ms2, uint32_t ms3, uint32_t ms4, u
 
 void hV_Board::b_waitBusy(bool state)
 {
+    uint32_t chrono = micros();
+
     // LOW = busy, HIGH = ready
     while (digitalRead(b_pin.panelBusy) != state)
     {
         delay(32); // non-blocking
     }
+
+    b_timeBusy += micros() - chrono;
 }
 
 void hV_Board::b_suspend()
 {
     if ((b_fsmPowerScreen & FSM_GPIO_MASK) == FSM_GPIO_MASK)
     {
+        uint32_t chrono = micros();
+
         // Optional power circuit
         if (b_pin.panelPower != NOT_CONNECTED) // generic
         {
             digitalWrite(b_pin.panelPower, LOW);
         }
-        b_fsmPowerScreen &= ~FSM_GPIO_MASK;
+        b_setFsm(b_fsmPowerScreen & ~FSM_GPIO_MASK);
+
+        b_statistics.suspendNumber += 1;
+        b_statistics.durationSuspend += micros() - chrono;
     }
 }
 
@@ -81,6 +142,28 @@ void hV_Board::b_resume()
 
     if ((b_fsmPowerScreen & FSM_GPIO_MASK) != FSM_GPIO_MASK)
     {
+        // Warm resume, GPIOs already configured, levels only
+        if (b_flagConfigured)
+        {
+            // Optional power circuit
+            if (b_pin.panelPower != NOT_CONNECTED) // generic
+            {
+                digitalWrite(b_pin.panelPower, HIGH);
+            }
+
+            digitalWrite(b_pin.panelDC, HIGH);
+            digitalWrite(b_pin.panelReset, HIGH);
+            digitalWrite(b_pin.panelCS, HIGH); // CS# = 1
+            if (b_pin.panelCSS != NOT_CONNECTED) // generic
+            {
+                digitalWrite(b_pin.panelCSS, HIGH);
+            }
+
+            b_flagWarm = true;
+            b_setFsm(b_fsmPowerScreen | FSM_GPIO_MASK);
+            return;
+        }
+
         // Optional power circuit
         if (b_pin.panelPower != NOT_CONNECTED) // generic
         {
@@ -163,7 +246,9 @@ void hV_Board::b_resume()
 
 #endif // USE_EXT_BOARD
 
-        b_fsmPowerScreen |= FSM_GPIO_MASK;
+        b_flagConfigured = true;
+        b_flagWarm = false;
+        b_setFsm(b_fsmPowerScreen | FSM_GPIO_MASK);
     }
 }
 
@@ -265,6 +350,33 @@ void hV_Board::b_sendIndexData(uint8_t index, const uint8_t * data, uint32_t siz
     delayMicroseconds(b_delayCS);
 }
 
+void hV_Board::b_sendIndexOnly(uint8_t index)
+{
+    digitalWrite(b_pin.panelDC, LOW); // DC Low = Command
+    digitalWrite(b_pin.panelCS, LOW); // CS Low = Select
+
+    delayMicroseconds(b_delayCS);
+    hV_HAL_SPI_transfer(index);
+    delayMicroseconds(b_delayCS);
+
+    digitalWrite(b_pin.panelCS, HIGH); // CS High = Unselect
+    digitalWrite(b_pin.panelDC, HIGH); // DC High = Data
+}
+
+void hV_Board::b_sendDataBlock(const uint8_t * data, uint32_t size)
+{
+    digitalWrite(b_pin.panelCS, LOW); // CS Low = Select
+
+    delayMicroseconds(b_delayCS);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        hV_HAL_SPI_transfer(data[i]);
+    }
+    delayMicroseconds(b_delayCS);
+
+    digitalWrite(b_pin.panelCS, HIGH); // CS High = Unselect
+}
+
 // Software SPI Master protocol setup
 void hV_Board::b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32_t size, uint8_t select)
 {
@@ -46,6 +46,26 @@
 ///
 #define hV_BOARD_RELEASE 812
 
+///
+/// @brief Statistics of the power state machine
+/// @details Time spent in each state and duration of the transitions
+/// @note Time in states in ms, duration of transitions in us
+///
+struct powerStatistics_s
+{
+    uint32_t timeOff; ///< time in FSM_OFF, ms
+    uint32_t timeGPIO; ///< time with GPIO only, ms
+    uint32_t timeSleep; ///< time in FSM_SLEEP, ms
+    uint32_t timeOn; ///< time in FSM_ON, ms
+    uint32_t resumeCold; ///< number of resumes with GPIO configuration
+    uint32_t resumeWarm; ///< number of resumes without GPIO configuration
+    uint32_t durationCold; ///< cumulated duration of cold resumes, us
+    uint32_t durationWarm; ///< cumulated duration of warm resumes, us
+    uint32_t durationResume; ///< duration of last resume, us
+    uint32_t suspendNumber; ///< number of suspends
+    uint32_t durationSuspend; ///< cumulated duration of suspends, us
+};
+
 // Objects
 //
 ///
@@ -77,6 +97,17 @@ class hV_Board
     ///
     pins_t getBoardPins();
 
+    ///
+    /// @brief Get the statistics of the power state machine
+    /// @return statistics, including time in current state
+    ///
+    powerStatistics_s getPowerStatistics();
+
+    ///
+    /// @brief Reset the statistics of the power state machine
+    ///
+    void resetPowerStatistics();
+
     /// @cond
   protected:
 
@@ -140,6 +171,23 @@ class hV_Board
     ///
     void b_sendIndexDataSelect(uint8_t index, const uint8_t * data, uint32_t size, uint8_t select = PANEL_CS_BOTH);
 
+    ///
+    /// @brief Send index only through SPI
+    /// @param index register
+    /// @note Data to be sent with b_sendDataBlock(), one or more blocks
+    /// @note Valid for all except large screens
+    ///
+    void b_sendIndexOnly(uint8_t index);
+
+    ///
+    /// @brief Send a block of data through SPI
+    /// @param data data
+    /// @param size number of bytes
+    /// @note /CS is released after the block, so the SPI bus can be shared between blocks
+    /// @note Valid for all except large screens
+    ///
+    void b_sendDataBlock(const uint8_t * data, uint32_t size);
+
     ///
     /// @brief Wait for ready
     /// @details Wait for panelBusy signal to reach state
@@ -184,11 +232,25 @@ class hV_Board
     ///
     void b_resume();
 
+    ///
+    /// @brief Set the state of the power state machine
+    /// @param state FSM_OFF, FSM_SLEEP, FSM_ON or with FSM_GPIO_MASK only
+    /// @note Time spent in previous state added to statistics
+    ///
+    void b_setFsm(uint8_t state);
+
     pins_t b_pin;
     uint16_t b_delayCS = 50; // ms
     uint8_t b_family;
     uint8_t b_fsmPowerScreen = FSM_OFF;
 
+    // Power state machine
+    powerStatistics_s b_statistics;
+    uint32_t b_chronoFsm; // ms, entry into current state
+    bool b_flagConfigured; // GPIOs configured since b_begin()
+    bool b_flagWarm; // last b_resume() without GPIO configuration
+    uint32_t b_timeBusy; // us, cumulated by b_waitBusy()
+
   private:
     /// @brief Select one half of large screens
     /// @param select default = PANEL_CS_BOTH, otherwise PANEL_CS_MASTER or PANEL_CS_SLAVE
@@ -0,0 +1,427 @@
+//
+// hV_Console.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 21 Jun 2025
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence All rights reserved
+//
+// Release 830: Initial release
+//
+
+// Library header
+#include "hV_Console.h"
+
+// States of the control sequence parser
+#define CONSOLE_TEXT 0 ///< characters
+#define CONSOLE_ESCAPE 1 ///< after ESC
+#define CONSOLE_CSI 2 ///< after ESC [
+
+hV_Console::hV_Console(hV_Screen_Buffer * screen)
+{
+    m_screen = screen;
+    m_y0 = 0;
+    m_dy = 0;
+    m_font = 0;
+    m_textColour = myColours.black;
+    m_backColour = myColours.white;
+    m_cellX = 0;
+    m_cellY = 0;
+    m_columns = 0;
+    m_rows = 0;
+    m_column = 0;
+    m_row = 0;
+    m_flagInverse = false;
+    m_flagWrap = false;
+    m_scrollNumber = 0;
+    m_state = CONSOLE_TEXT;
+    m_parameter[0] = 0;
+    m_parameter[1] = 0;
+    m_parameters = 0;
+    m_utf8Length = 0;
+    m_utf8Expected = 0;
+}
+
+void hV_Console::setArea(uint16_t y0, uint16_t dy, uint8_t font)
+{
+    m_y0 = y0;
+    m_dy = dy;
+    m_font = font;
+
+    uint8_t oldFont = m_screen->getFont();
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(m_font);
+    }
+
+    // Widest character as drawn by gText(), same as hV_TextField
+    m_cellX = m_screen->characterSizeX();
+    m_cellY = m_screen->characterSizeY();
+
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(oldFont);
+    }
+
+    m_columns = hV_HAL_min(m_screen->screenSizeX() / m_cellX, 255);
+    m_rows = hV_HAL_min(m_dy / m_cellY, 255);
+
+    m_scrollNumber = 0;
+    m_flagInverse = false;
+    m_state = CONSOLE_TEXT;
+    m_utf8Length = 0;
+    m_utf8Expected = 0;
+    clear();
+}
+
+void hV_Console::setColours(uint16_t textColour, uint16_t backColour)
+{
+    m_textColour = textColour;
+    m_backColour = backColour;
+}
+
+void hV_Console::clear()
+{
+    bool oldPenSolid = m_screen->getPenSolid();
+    m_screen->setPenSolid(true);
+    m_screen->dRectangle(0, m_y0, m_screen->screenSizeX(), m_dy, m_backColour);
+    m_screen->setPenSolid(oldPenSolid);
+
+    setCursor(0, 0);
+}
+
+void hV_Console::setCursor(uint8_t column, uint8_t row)
+{
+    m_column = (column < m_columns) ? column : m_columns - 1;
+    m_row = (row < m_rows) ? row : m_rows - 1;
+    m_flagWrap = false;
+}
+
+uint8_t hV_Console::getColumns()
+{
+    return m_columns;
+}
+
+uint8_t hV_Console::getRows()
+{
+    return m_rows;
+}
+
+uint32_t hV_Console::getScrollNumber()
+{
+    return m_scrollNumber;
+}
+
+size_t hV_Console::write(uint8_t data)
+{
+    return write(&data, 1);
+}
+
+size_t hV_Console::write(const uint8_t * buffer, size_t size)
+{
+    if ((m_columns == 0) or (m_rows == 0))
+    {
+        return 0;
+    }
+
+    uint8_t oldFont = m_screen->getFont();
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(m_font);
+    }
+    bool oldFontSolid = m_screen->getFontSolid();
+    m_screen->setFontSolid(true);
+
+    for (size_t index = 0; index < size; index += 1)
+    {
+        m_process(buffer[index]);
+    }
+
+    m_screen->setFontSolid(oldFontSolid);
+
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(oldFont);
+    }
+
+    return size;
+}
+
+void hV_Console::m_process(uint8_t data)
+{
+    switch (m_state)
+    {
+        case CONSOLE_ESCAPE:
+
+            m_state = CONSOLE_TEXT;
+            if (data == '[')
+            {
+                m_state = CONSOLE_CSI;
+                m_parameter[0] = 0;
+                m_parameter[1] = 0;
+                m_parameters = 0;
+            }
+            else if (data == 'c')
+            {
+                m_flagInverse = false;
+                clear();
+            }
+            return;
+
+        case CONSOLE_CSI:
+
+            if ((data >= '0') and (data <= '9'))
+            {
+                uint16_t value = m_parameter[m_parameters] * 10 + (data - '0');
+                m_parameter[m_parameters] = hV_HAL_min(value, 255);
+            }
+            else if (data == ';')
+            {
+                if (m_parameters < 1)
+                {
+                    m_parameters += 1;
+                }
+            }
+            else if ((data >= 0x40) and (data <= 0x7e))
+            {
+                m_command(data);
+                m_state = CONSOLE_TEXT;
+            }
+            return; // Other bytes ignored
+
+        default:
+
+            break;
+    }
+
+    // UTF-8 continuation
+    if (m_utf8Expected > 0)
+    {
+        if ((data & 0xc0) == 0x80)
+        {
+            m_utf8[m_utf8Length] = data;
+            m_utf8Length += 1;
+            if (m_utf8Length == m_utf8Expected)
+            {
+                m_drawCharacter();
+            }
+            return;
+        }
+
+        // Truncated sequence, decoded as ISO-8859-1
+        m_drawCharacter();
+    }
+
+    switch (data)
+    {
+        case 0x1b: // ESC
+
+            m_state = CONSOLE_ESCAPE;
+            break;
+
+        case '\n':
+
+            m_newLine();
+            break;
+
+        case '\r':
+
+            m_column = 0;
+            m_flagWrap = false;
+            break;
+
+        case '\b':
+
+            if (m_column > 0)
+            {
+                m_column -= 1;
+            }
+            m_flagWrap = false;
+            break;
+
+        case '\t':
+
+            m_column = hV_HAL_min((m_column / 8 + 1) * 8, m_columns - 1);
+            m_flagWrap = false;
+            break;
+
+        default:
+
+            if (data < 0x20)
+            {
+                break; // Other control characters ignored
+            }
+
+            m_utf8[0] = data;
+            m_utf8Length = 1;
+            m_utf8Expected = 1;
+            if (data >= 0xf0)
+            {
+                m_utf8Expected = 4;
+            }
+            else if (data >= 0xe0)
+            {
+                m_utf8Expected = 3;
+            }
+            else if (data >= 0xc0)
+            {
+                m_utf8Expected = 2;
+            }
+
+            if (m_utf8Expected == 1)
+            {
+                m_drawCharacter();
+            }
+            break;
+    }
+}
+
+void hV_Console::m_command(uint8_t command)
+{
+    uint8_t number = (m_parameter[0] > 0) ? m_parameter[0] : 1;
+
+    switch (command)
+    {
+        case 'A': // Up
+
+            m_row = (m_row > number) ? m_row - number : 0;
+            m_flagWrap = false;
+            break;
+
+        case 'B': // Down
+
+            setCursor(m_column, hV_HAL_min(m_row + number, 255));
+            break;
+
+        case 'C': // Right
+
+            setCursor(hV_HAL_min(m_column + number, 255), m_row);
+            break;
+
+        case 'D': // Left
+
+            m_column = (m_column > number) ? m_column - number : 0;
+            m_flagWrap = false;
+            break;
+
+        case 'H': // Position, from 1
+        case 'f':
+
+            setCursor((m_parameter[1] > 0) ? m_parameter[1] - 1 : 0, (m_parameter[0] > 0) ? m_parameter[0] - 1 : 0);
+            break;
+
+        case 'J': // Clear
+
+            if (m_parameter[0] == 2)
+            {
+                clear();
+            }
+            else if (m_parameter[0] == 0)
+            {
+                m_clearCells(m_column, m_row, m_columns - m_column, 1);
+                m_clearCells(0, m_row + 1, m_columns, m_rows - m_row - 1);
+            }
+            break;
+
+        case 'K': // Clear line
+
+            m_clearCells(m_column, m_row, m_columns - m_column, 1);
+            break;
+
+        case 'm': // Attributes
+
+            for (uint8_t index = 0; index <= m_parameters; index += 1)
+            {
+                if (m_parameter[index] == 7)
+                {
+                    m_flagInverse = true;
+                }
+                else if ((m_parameter[index] == 0) or (m_parameter[index] == 27))
+                {
+                    m_flagInverse = false;
+                }
+            }
+            break;
+
+        default:
+
+            break;
+    }
+}
+
+void hV_Console::m_drawCharacter()
+{
+    // Deferred wrap, as VT100
+    if (m_flagWrap)
+    {
+        m_newLine();
+    }
+
+    uint16_t x = m_column * m_cellX;
+    uint16_t y = m_y0 + m_row * m_cellY;
+    uint16_t textColour = m_flagInverse ? m_backColour : m_textColour;
+    uint16_t backColour = m_flagInverse ? m_textColour : m_backColour;
+
+    m_screen->gText(x, y, m_utf8, m_utf8Length, textColour, backColour);
+
+    // Proportional font, clear the rest of the cell
+    uint16_t width = m_screen->stringSizeX(m_utf8, m_utf8Length);
+    if (width < m_cellX)
+    {
+        bool oldPenSolid = m_screen->getPenSolid();
+        m_screen->setPenSolid(true);
+        m_screen->dRectangle(x + width, y, m_cellX - width, m_cellY, backColour);
+        m_screen->setPenSolid(oldPenSolid);
+    }
+
+    m_utf8Length = 0;
+    m_utf8Expected = 0;
+
+    if (m_column + 1 < m_columns)
+    {
+        m_column += 1;
+    }
+    else
+    {
+        m_flagWrap = true;
+    }
+}
+
+void hV_Console::m_newLine()
+{
+    m_column = 0;
+    m_flagWrap = false;
+
+    if (m_row + 1 < m_rows)
+    {
+        m_row += 1;
+    }
+    else if (m_screen->scroll(m_y0, m_rows * m_cellY, m_cellY, m_backColour) == RESULT_SUCCESS)
+    {
+        m_scrollNumber += 1;
+    }
+    else
+    {
+        // Scroll not available, new page
+        clear();
+    }
+}
+
+void hV_Console::m_clearCells(uint8_t column, uint8_t row, uint8_t columns, uint8_t rows)
+{
+    if ((columns == 0) or (rows == 0))
+    {
+        return;
+    }
+
+    bool oldPenSolid = m_screen->getPenSolid();
+    m_screen->setPenSolid(true);
+    m_screen->dRectangle(column * m_cellX, m_y0 + row * m_cellY, columns * m_cellX, rows * m_cellY, m_backColour);
+    m_screen->setPenSolid(oldPenSolid);
+}
+
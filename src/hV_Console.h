@@ -0,0 +1,221 @@
+///
+/// @file hV_Console.h
+/// @brief Scrolling text console
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Terminal on a band of the screen, fed by print() and println()
+/// * Cursor, line wrap, scroll when the bottom line is full
+/// * Scroll by shifting the frame-buffer, no text drawn again
+/// * Subset of VT100 control sequences
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+#ifndef hV_CONSOLE_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_CONSOLE_RELEASE 830
+
+// Objects
+//
+///
+/// @brief Class for text console
+/// @details Characters are written at the cursor, as with a serial terminal.
+/// When the bottom line is full, the band is scrolled up by one line
+/// with scroll() and only the new line is drawn.
+///
+/// @n Control characters
+/// * \n new line, \r carriage return, \b backspace, \t tabulation every 8 columns
+///
+/// @n VT100 control sequences, ESC = \x1b
+/// * ESC [ 2 J clear the console and move the cursor home, ESC [ J clear below the cursor
+/// * ESC [ K clear to the end of the line
+/// * ESC [ row ; column H cursor position, from 1, ESC [ H cursor home
+/// * ESC [ n A, B, C, D cursor up, down, right, left, default n = 1
+/// * ESC [ 7 m inverse, ESC [ 27 m or ESC [ 0 m or ESC [ m normal
+/// * ESC c reset
+/// * Other sequences are ignored
+///
+/// @note The console spans the whole width of the screen.
+/// If scroll() is not available, the console is cleared and the cursor moved home instead.
+/// @note The console draws into the frame-buffer, call flush() to update the screen
+///
+/// @n Example
+/// @code {.cpp}
+/// hV_Console myConsole(&myScreen);
+/// myConsole.setArea(0, myScreen.screenSizeY(), Font_Terminal6x8);
+/// myConsole.println("Hello");
+/// myConsole.print("\x1b[7mInverse\x1b[0m");
+/// myScreen.flush();
+/// @endcode
+///
+class hV_Console : public Print
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_Console(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the area and the font
+    /// @param y0 top coordinate of the band, y-axis
+    /// @param dy height of the band, y-axis
+    /// @param font font number, 0..fontMax()-1, default = Font_Terminal6x8
+    /// @note Clears the console and moves the cursor home
+    ///
+    void setArea(uint16_t y0, uint16_t dy, uint8_t font = Font_Terminal6x8);
+
+    ///
+    /// @brief Set the colours
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    ///
+    void setColours(uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Clear the console and move the cursor home
+    ///
+    void clear();
+
+    ///
+    /// @brief Move the cursor
+    /// @param column column, from 0
+    /// @param row row, from 0
+    ///
+    void setCursor(uint8_t column, uint8_t row);
+
+    ///
+    /// @brief Number of columns
+    /// @return number of characters per line
+    ///
+    uint8_t getColumns();
+
+    ///
+    /// @brief Number of rows
+    /// @return number of lines
+    ///
+    uint8_t getRows();
+
+    ///
+    /// @brief Number of scrolls
+    /// @return number of lines scrolled since setArea()
+    ///
+    uint32_t getScrollNumber();
+
+    ///
+    /// @brief Write one byte
+    /// @param data byte, UTF-8 sequences are decoded
+    /// @return 1
+    /// @note Required by Print
+    ///
+    size_t write(uint8_t data);
+
+    ///
+    /// @brief Write bytes
+    /// @param buffer bytes, UTF-8 sequences are decoded
+    /// @param size number of bytes
+    /// @return number of bytes written
+    /// @note Font selected once for the whole buffer
+    ///
+    size_t write(const uint8_t * buffer, size_t size);
+
+    using Print::write;
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Process one byte, font already selected
+    /// @param data byte
+    ///
+    void m_process(uint8_t data);
+
+    ///
+    /// @brief Process a control sequence
+    /// @param command final byte of the sequence
+    ///
+    void m_command(uint8_t command);
+
+    ///
+    /// @brief Draw the pending character at the cursor and move the cursor
+    ///
+    void m_drawCharacter();
+
+    ///
+    /// @brief Move the cursor to the next line, scroll if needed
+    ///
+    void m_newLine();
+
+    ///
+    /// @brief Clear cells
+    /// @param column first column
+    /// @param row first row
+    /// @param columns number of columns
+    /// @param rows number of rows
+    ///
+    void m_clearCells(uint8_t column, uint8_t row, uint8_t columns, uint8_t rows);
+
+    hV_Screen_Buffer * m_screen;
+    uint16_t m_y0, m_dy;
+    uint8_t m_font;
+    uint16_t m_textColour, m_backColour;
+    uint16_t m_cellX, m_cellY;
+    uint8_t m_columns, m_rows;
+    uint8_t m_column, m_row;
+    bool m_flagInverse;
+    bool m_flagWrap; // cursor after the last column
+    uint32_t m_scrollNumber;
+
+    // Escape sequence
+    uint8_t m_state;
+    uint8_t m_parameter[2];
+    uint8_t m_parameters;
+
+    // UTF-8 sequence
+    char m_utf8[4];
+    uint8_t m_utf8Length;
+    uint8_t m_utf8Expected;
+
+    /// @endcond
+};
+
+#endif // hV_CONSOLE_RELEASE
+
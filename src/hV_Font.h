@@ -71,6 +71,18 @@ struct width_s
     uint32_t index; ///< relative address
 };
 
+///
+/// @brief Structure for range of code points
+/// @details Code points first~last are glyphs glyph~glyph + last - first
+/// @note Unicode Basic Multilingual Plane only
+///
+struct range_s
+{
+    uint16_t first; ///< first code point
+    uint16_t last; ///< last code point, included
+    uint8_t glyph; ///< glyph of the first code point, 0~223
+};
+
 ///
 /// @brief Structure for font
 /// @details Fonts read from header file in internal MCU Flash
@@ -93,6 +105,16 @@ struct width_s
 ///   - b2 = 0x-4 = d4 = bold
 ///   - b10 = 0x-0..0x-3 = d0..d3 = variant number
 ///
+/// @n Proportional Terminal fonts
+/// * width of character c = column[c + 1] - column[c]
+/// * first byte of character c = column[c] * bytes per column
+/// * bytes per column = (height + 7) / 8
+///
+/// @n Sparse Terminal fonts
+/// * ranges of code points, sorted, not overlapping
+/// * glyph of code point p in range r = r.glyph + p - r.first, 0~number - 1
+/// * without ranges, glyph of code point p = p - first, ISO-8859-1
+///
 /// @warning font_s.table needs to be uint8_t instead of unsigned short
 /// @n Otherwise on TM4C129, font_s.table written as uint16_t
 ///
@@ -103,6 +125,10 @@ struct font_s
     uint8_t maxWidth; ///< maximum width in pixels from *width array
     uint8_t first; ///< number of first character, usually 32
     uint8_t number; ///< number of characters, usually 96 or 224
+    const uint16_t * column; ///< proportional font: first column of each character, nullptr if monospaced
+    const uint8_t * table; ///< proportional font: columns, nullptr if monospaced
+    const range_s * range; ///< sparse font: ranges of code points, nullptr if ISO-8859-1
+    uint8_t ranges; ///< sparse font: number of ranges
 };
 
 #endif // USE_FONT_TERMINAL
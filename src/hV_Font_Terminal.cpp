@@ -20,8 +20,19 @@
 // All rights reserved
 //
 // Release 803: Added types for string and frame-buffer
+// Release 830: Added heap-free measurement functions
+// Release 830: Added UTF-8 decoding
+// Release 830: Added font subset and bit-packed Terminal8x12e
+// Release 830: Added proportional fonts
+// Release 830: Added fonts on external SPI Flash with LRU glyph cache
+// Release 830: Added sparse fonts with ranges of code points and addFont()
+// Release 830: Exact string measurement for monospaced fonts
+// Release 830: General size of proportional fonts as widest character
 //
 
+// Font tables, defined in this unit only
+#define hV_FONT_TERMINAL_DEFINITION
+
 // Configuration
 #include "hV_Configuration.h"
 
@@ -31,6 +42,39 @@
 // Font structure
 #include "hV_Font_Terminal.h"
 
+// Font subset
+#define FONT_SUBSET_BIT(block) ((FONT_SUBSET >> (block)) & 0x01)
+
+// Row of the first character of each block of 32 characters
+static const uint8_t subsetRow[7] =
+{
+    0,
+    32 * (FONT_SUBSET_BIT(0)),
+    32 * (FONT_SUBSET_BIT(0) + FONT_SUBSET_BIT(1)),
+    32 * (FONT_SUBSET_BIT(0) + FONT_SUBSET_BIT(1) + FONT_SUBSET_BIT(2)),
+    32 * (FONT_SUBSET_BIT(0) + FONT_SUBSET_BIT(1) + FONT_SUBSET_BIT(2) + FONT_SUBSET_BIT(3)),
+    32 * (FONT_SUBSET_BIT(0) + FONT_SUBSET_BIT(1) + FONT_SUBSET_BIT(2) + FONT_SUBSET_BIT(3) + FONT_SUBSET_BIT(4)),
+    32 * (FONT_SUBSET_BIT(0) + FONT_SUBSET_BIT(1) + FONT_SUBSET_BIT(2) + FONT_SUBSET_BIT(3) + FONT_SUBSET_BIT(4) + FONT_SUBSET_BIT(5)),
+};
+
+// Number of Terminal fonts, added fonts numbered after
+#if (FONT_PROPORTIONAL == USE_FONT_PROPORTIONAL_YES)
+#define FONT_TERMINAL_NUMBER (Font_Terminal12x16p + 1)
+#else
+#define FONT_TERMINAL_NUMBER MAX_FONT_SIZE
+#endif // FONT_PROPORTIONAL
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+// Font on SPI Flash, little endian
+// * Header, 12 bytes: 'h' 'V' 'F' 0x01, kind, height, maxWidth, first, number, ranges, 2 reserved
+// * Table of ranges: 6 bytes per range, first uint16_t, last uint16_t, glyph, 1 reserved
+// * Table of columns: uint16_t column[number + 1], as for proportional fonts
+// * Table of glyphs: columns, LSB at top, (height + 7) / 8 bytes per column
+#define FONT_FLASH_HEADER 12
+#define FONT_FLASH_RANGE 6
+#define FONT_FLASH_EMPTY 0xff
+#endif // FONT_FLASH
+
 // Code
 // Font functions
 // hV_Font_Terminal::hV_Font_Terminal()
@@ -40,6 +84,30 @@ void hV_Font_Terminal::f_begin()
     f_fontNumber = MAX_FONT_SIZE;
     f_fontSolid = true;
     f_fontSpaceX = 1;
+    f_fontReplacement = '?';
+    f_addedNumber = 0;
+    f_rangeLast = 0;
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+    f_fontFlash = false;
+    memset(f_cacheFont, FONT_FLASH_EMPTY, sizeof(f_cacheFont));
+    memset(f_cacheStamp, 0x00, sizeof(f_cacheStamp));
+    memset(f_cachePending, 0x00, sizeof(f_cachePending));
+    f_cacheTick = 0;
+    f_cacheLast = 0;
+    memset(&f_cacheStatistics, 0x00, sizeof(f_cacheStatistics));
+#endif // FONT_FLASH
+
+    // '?' not part of the subset, first character of the subset instead
+    if (FONT_SUBSET_BIT(0) == 0)
+    {
+        uint8_t block = 1;
+        while (FONT_SUBSET_BIT(block) == 0)
+        {
+            block += 1;
+        }
+        f_fontReplacement = 0x20 + 32 * block;
+    }
 
     // Take first font
     f_selectFont(0);
@@ -47,7 +115,24 @@ void hV_Font_Terminal::f_begin()
 
 uint8_t hV_Font_Terminal::f_addFont(font_s fontName)
 {
-    return f_fontNumber;
+    // Proportional fonts generated by extras/bdf2pdls.py only
+    if ((fontName.column == nullptr) or (fontName.table == nullptr) or (fontName.first != 32) or
+            (fontName.number == 0) or (fontName.number > 224))
+    {
+        mySerial.println("hV * Font not supported");
+        return 0;
+    }
+
+    if (f_addedNumber >= MAX_FONT_ADDED)
+    {
+        mySerial.println("hV * Maximum number of added fonts reached");
+        return 0;
+    }
+
+    f_addedFont[f_addedNumber] = fontName;
+    f_addedNumber += 1;
+
+    return FONT_TERMINAL_NUMBER + f_addedNumber - 1;
 }
 
 void hV_Font_Terminal::f_setFontSolid(bool flag)
@@ -57,10 +142,75 @@ void hV_Font_Terminal::f_setFontSolid(bool flag)
 
 void hV_Font_Terminal::f_selectFont(uint8_t size)
 {
+    f_rangeLast = 0;
+
+    // Added fonts, numbered after the Terminal fonts
+    if ((size >= FONT_TERMINAL_NUMBER) and (size < FONT_TERMINAL_NUMBER + f_addedNumber))
+    {
+        uint8_t font = size - FONT_TERMINAL_NUMBER;
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+        if (f_addedFont[font].table == nullptr) // Font on SPI Flash
+        {
+            // Tables of ranges and columns already read
+            if (f_fontFlash and (size == f_fontSize))
+            {
+                return;
+            }
+
+            uint8_t bytes[FONT_FLASH_RANGE];
+            uint32_t address = f_flashAddress[font] + FONT_FLASH_HEADER;
+
+            f_fontSize = size;
+            f_font = f_addedFont[font];
+            f_font.column = f_flashColumn;
+            f_font.range = (f_font.ranges > 0) ? f_flashRange : nullptr;
+
+            f_flash.readBegin(address);
+            for (uint8_t index = 0; index < f_font.ranges; index += 1)
+            {
+                f_flash.readNext(bytes, FONT_FLASH_RANGE);
+                f_flashRange[index].first = bytes[0] | (bytes[1] << 8);
+                f_flashRange[index].last = bytes[2] | (bytes[3] << 8);
+                f_flashRange[index].glyph = bytes[4];
+            }
+            for (uint16_t index = 0; index <= f_font.number; index += 1)
+            {
+                f_flash.readNext(bytes, 2);
+                f_flashColumn[index] = bytes[0] | (bytes[1] << 8);
+            }
+            f_flash.readEnd();
+
+            address += FONT_FLASH_RANGE * f_font.ranges + 2 * (f_font.number + 1);
+            f_cacheStatistics.reads += 1;
+            f_cacheStatistics.bytes += address - f_flashAddress[font] - FONT_FLASH_HEADER;
+
+            f_flashTable = address;
+            f_fontFlash = true;
+            return;
+        }
+        f_fontFlash = false;
+#endif // FONT_FLASH
+
+        f_fontSize = size;
+        f_font = f_addedFont[font];
+        return;
+    }
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+    f_fontFlash = false;
+#endif // FONT_FLASH
+
     if (size < MAX_FONT_SIZE)
     {
         f_fontSize = size;
     }
+#if (FONT_PROPORTIONAL == USE_FONT_PROPORTIONAL_YES)
+    else if ((size == Font_Terminal8x12p) or (size == Font_Terminal12x16p))
+    {
+        f_fontSize = size;
+    }
+#endif // FONT_PROPORTIONAL
     else
     {
         f_fontSize = MAX_FONT_SIZE - 1;
@@ -69,21 +219,31 @@ void hV_Font_Terminal::f_selectFont(uint8_t size)
     switch (f_fontSize)
     {
         case 0:
-            // kind, height, maxWidth, first, number
-            f_font = { 0x40, 8, 6, 32, 224 };
+            // kind, height, maxWidth, first, number, column, table, range, ranges
+            f_font = { 0x40, 8, 6, 32, 224, nullptr, nullptr, nullptr, 0 };
             break;
 
         case 1:
-            f_font = { 0x40, 12, 8, 32, 224 };
+            f_font = { 0x40, 12, 8, 32, 224, nullptr, nullptr, nullptr, 0 };
             break;
 
         case 2:
-            f_font = { 0x40, 16, 12, 32, 224 };
+            f_font = { 0x40, 16, 12, 32, 224, nullptr, nullptr, nullptr, 0 };
             break;
 
         case 3:
-            f_font = { 0x40, 24, 16, 32, 224 };
+            f_font = { 0x40, 24, 16, 32, 224, nullptr, nullptr, nullptr, 0 };
+            break;
+
+#if (FONT_PROPORTIONAL == USE_FONT_PROPORTIONAL_YES)
+        case Font_Terminal8x12p:
+            f_font = Terminal8x12p_font;
+            break;
+
+        case Font_Terminal12x16p:
+            f_font = Terminal12x16p_font;
             break;
+#endif // FONT_PROPORTIONAL
 
         default:
             break;
@@ -92,7 +252,7 @@ void hV_Font_Terminal::f_selectFont(uint8_t size)
 
 uint8_t hV_Font_Terminal::f_fontMax()
 {
-    return MAX_FONT_SIZE;
+    return FONT_TERMINAL_NUMBER + f_addedNumber;
 }
 
 void hV_Font_Terminal::f_setFontSpaceX(uint8_t number)
@@ -105,8 +265,146 @@ void hV_Font_Terminal::f_setFontSpaceY(uint8_t number)
     f_fontSpaceY = number;
 }
 
+void hV_Font_Terminal::f_setFontReplacement(uint8_t character)
+{
+    if ((character >= 0x20) and (FONT_SUBSET_BIT((character - 0x20) >> 5)))
+    {
+        f_fontReplacement = character;
+    }
+}
+
+uint8_t hV_Font_Terminal::f_findRange(uint32_t codePoint)
+{
+    // Same range as previous code point, most likely
+    const range_s * range = f_font.range + f_rangeLast;
+
+    if ((codePoint < range->first) or (codePoint > range->last))
+    {
+        // Binary search, ranges sorted
+        uint8_t low = 0;
+        uint8_t high = f_font.ranges;
+        range = nullptr;
+
+        while (low < high)
+        {
+            uint8_t middle = (low + high) / 2;
+            if (codePoint < f_font.range[middle].first)
+            {
+                high = middle;
+            }
+            else if (codePoint > f_font.range[middle].last)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                f_rangeLast = middle;
+                range = f_font.range + middle;
+                break;
+            }
+        }
+
+        if (range == nullptr)
+        {
+            return 0;
+        }
+    }
+
+    return 0x20 + range->glyph + (codePoint - range->first);
+}
+
+uint8_t hV_Font_Terminal::f_getGlyph(uint32_t codePoint)
+{
+    // Sparse font, ranges of code points
+    if (f_font.range != nullptr)
+    {
+        uint8_t glyph = f_findRange(codePoint);
+        if (glyph == 0)
+        {
+            glyph = f_findRange(f_fontReplacement);
+        }
+        if (glyph == 0)
+        {
+            glyph = 0x20; // First glyph
+        }
+        return glyph;
+    }
+
+    uint8_t character = f_fontReplacement;
+
+    if ((codePoint >= 0x20) and (codePoint < 0x0100))
+    {
+        character = codePoint;
+    }
+    else if (codePoint == 0x20ac) // Euro
+    {
+        character = 0x80;
+    }
+
+    // Added font, no subset but number of characters
+    if (f_fontSize >= FONT_TERMINAL_NUMBER)
+    {
+        if (character - 0x20 >= f_font.number)
+        {
+            character = f_fontReplacement;
+        }
+        if (character - 0x20 >= f_font.number)
+        {
+            character = 0x20;
+        }
+        return character;
+    }
+
+    // Outside the subset
+    if (FONT_SUBSET_BIT((character - 0x20) >> 5) == 0)
+    {
+        character = f_fontReplacement;
+    }
+
+    return character;
+}
+
+uint16_t hV_Font_Terminal::f_countGlyphs(const char * text, uint16_t length)
+{
+    uint16_t index = 0;
+    uint16_t count = 0;
+
+    while (index < length)
+    {
+        utf8CodePoint(text, length, index);
+        count += 1;
+    }
+
+    return count;
+}
+
+uint8_t hV_Font_Terminal::f_getCharacterRow(uint8_t character)
+{
+    return subsetRow[character >> 5] + (character & 0x1f);
+}
+
 uint8_t hV_Font_Terminal::f_getCharacter(uint8_t character, uint16_t index)
 {
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+    // Font on SPI Flash, glyph from the cache
+    if (f_fontFlash)
+    {
+        if ((f_cacheFont[f_cacheLast] != f_fontSize) or (f_cacheCharacter[f_cacheLast] != character))
+        {
+            f_loadGlyph(character, nullptr, 0, 0);
+        }
+        return f_cacheData[f_cacheLast][index];
+    }
+#endif // FONT_FLASH
+
+    // Proportional font, full table
+    if (f_font.table != nullptr)
+    {
+        return f_font.table[f_getCharacterWidth(character).index + index];
+    }
+
+    character = f_getCharacterRow(character);
+
 #if (MAX_FONT_SIZE > 0)
     if (f_fontSize == 0)
     {
@@ -115,7 +413,15 @@ uint8_t hV_Font_Terminal::f_getCharacter(uint8_t character, uint16_t index)
 #if (MAX_FONT_SIZE > 1)
     else if (f_fontSize == 1)
     {
-        return Terminal8x12e[character][index];
+        // Bit-packed, rows 8~11 on nibbles
+        if ((index & 0x01) == 0x00)
+        {
+            return Terminal8x12e[character][index >> 1];
+        }
+        else
+        {
+            return (Terminal8x12e[character][8 + (index >> 2)] >> ((index & 0x02) << 1)) & 0x0f;
+        }
     }
 #if (MAX_FONT_SIZE > 2)
     else if (f_fontSize == 2)
@@ -137,8 +443,37 @@ uint8_t hV_Font_Terminal::f_getCharacter(uint8_t character, uint16_t index)
 #endif // end MAX_FONT_SIZE > 0
 }
 
+width_s hV_Font_Terminal::f_getCharacterWidth(uint8_t character)
+{
+    width_s result;
+
+    if (f_font.column != nullptr) // Proportional font
+    {
+        result.pixel = f_font.column[character + 1] - f_font.column[character];
+        result.index = (uint32_t)f_font.column[character] * ((f_font.height + 7) / 8);
+    }
+    else // Monospaced font
+    {
+        result.pixel = f_font.maxWidth;
+        result.index = 0;
+    }
+
+    return result;
+}
+
 uint16_t hV_Font_Terminal::f_characterSizeX(uint8_t character)
 {
+    if (f_font.column != nullptr)
+    {
+        if (character >= f_font.first)
+        {
+            return f_getCharacterWidth(f_getGlyph(character) - f_font.first).pixel + f_fontSpaceX;
+        }
+
+        // General size, widest character
+        return f_font.maxWidth + f_fontSpaceX;
+    }
+
     return f_font.maxWidth;
 }
 
@@ -147,31 +482,59 @@ uint16_t hV_Font_Terminal::f_characterSizeY()
     return f_font.height;
 }
 
-uint16_t hV_Font_Terminal::f_stringSizeX(STRING_CONST_TYPE text)
+uint16_t hV_Font_Terminal::f_stringSizeX(const char * text, uint16_t length)
 {
     uint16_t textWidth = 0;
-    uint8_t textLength = 0;
-
-    textLength = text.length();
 
-    textWidth = (f_font.maxWidth + f_fontSpaceX) * textLength;
+    if (f_font.column != nullptr) // Proportional font
+    {
+        uint16_t index = 0;
+        while (index < length)
+        {
+            uint8_t character = f_getGlyph(utf8CodePoint(text, length, index)) - ' ';
+            textWidth += f_getCharacterWidth(character).pixel + f_fontSpaceX;
+        }
+    }
+    else // Monospaced font, spacing included in the glyphs
+    {
+        textWidth = f_font.maxWidth * f_countGlyphs(text, length);
+    }
 
     return textWidth;
 }
 
-uint8_t hV_Font_Terminal::f_stringLengthToFitX(STRING_CONST_TYPE text, uint16_t pixels)
+uint8_t hV_Font_Terminal::f_stringLengthToFitX(const char * text, uint16_t length, uint16_t pixels)
 {
-    uint8_t index = 0;
-    uint16_t textWidth = 0;
-    uint8_t textLength = 0;
+    uint16_t number = 0;
+    uint16_t index = 0;
 
-    textLength = text.length();
+    if (f_font.column != nullptr) // Proportional font
+    {
+        uint16_t textWidth = 0;
+        uint16_t next = 0;
+        while (index < length)
+        {
+            next = index;
+            uint8_t character = f_getGlyph(utf8CodePoint(text, length, next)) - ' ';
+            textWidth += f_getCharacterWidth(character).pixel + f_fontSpaceX;
+            if (textWidth > pixels)
+            {
+                break;
+            }
+            index = next;
+        }
 
-    // Monospaced font
-    index = pixels / f_font.maxWidth - 1;
-    if (index > textLength)
+        return index;
+    }
+
+    // Monospaced font, spacing included in the glyphs
+    number = pixels / f_font.maxWidth;
+
+    // Number of bytes for the number of characters
+    while ((index < length) and (number > 0))
     {
-        index = textLength;
+        utf8CodePoint(text, length, index);
+        number -= 1;
     }
 
     return index;
@@ -179,11 +542,215 @@ uint8_t hV_Font_Terminal::f_stringLengthToFitX(STRING_CONST_TYPE text, uint16_t
 
 uint8_t hV_Font_Terminal::f_getFontKind()
 {
-    return f_font.kind; // monospaced
+    return f_font.kind; // 0x40 = monospaced
 }
 uint8_t hV_Font_Terminal::f_getFontMaxWidth()
 {
     return f_font.maxWidth;
 }
 
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+
+uint8_t hV_Font_Terminal::f_addFontFlash(uint32_t address)
+{
+    if (f_addedNumber >= MAX_FONT_ADDED)
+    {
+        mySerial.println("hV * Maximum number of added fonts reached");
+        return 0;
+    }
+
+    uint8_t header[FONT_FLASH_HEADER];
+    f_flash.read(address, header, FONT_FLASH_HEADER);
+    f_cacheStatistics.reads += 1;
+    f_cacheStatistics.bytes += FONT_FLASH_HEADER;
+
+    if ((header[0] != 'h') or (header[1] != 'V') or (header[2] != 'F') or (header[3] != 0x01))
+    {
+        mySerial.println("hV * No font on SPI Flash at address");
+        return 0;
+    }
+
+    // kind, height, maxWidth, first, number, column, table, range, ranges
+    font_s font = { header[4], header[5], header[6], header[7], header[8], nullptr, nullptr, nullptr, header[9] };
+
+    if ((font.first != 32) or (font.number == 0) or (font.number > 224) or (font.height == 0) or
+            (font.ranges > FONT_FLASH_RANGES) or
+            ((uint16_t)font.maxWidth * ((font.height + 7) / 8) > FONT_FLASH_GLYPH_SIZE))
+    {
+        mySerial.println("hV * Font on SPI Flash not supported");
+        return 0;
+    }
+
+    f_flashAddress[f_addedNumber] = address;
+    f_addedFont[f_addedNumber] = font;
+    f_addedNumber += 1;
+
+    return FONT_TERMINAL_NUMBER + f_addedNumber - 1;
+}
+
+uint8_t hV_Font_Terminal::f_findGlyph(uint8_t character)
+{
+    for (uint8_t slot = 0; slot < FONT_FLASH_CACHE_GLYPHS; slot += 1)
+    {
+        if ((f_cacheFont[slot] == f_fontSize) and (f_cacheCharacter[slot] == character))
+        {
+            return slot;
+        }
+    }
+
+    return FONT_FLASH_CACHE_GLYPHS;
+}
+
+void hV_Font_Terminal::f_loadGlyph(uint8_t character, const char * text, uint16_t length, uint16_t index)
+{
+    // Clock for last use, order lost on roll-over
+    f_cacheTick += 1;
+    if (f_cacheTick == 0)
+    {
+        memset(f_cacheStamp, 0x00, sizeof(f_cacheStamp));
+        f_cacheTick = 1;
+    }
+
+    uint8_t slot = f_findGlyph(character);
+    if (slot < FONT_FLASH_CACHE_GLYPHS)
+    {
+        if (f_cachePending[slot]) // Read ahead
+        {
+            f_cacheStatistics.misses += 1;
+            f_cachePending[slot] = false;
+        }
+        else
+        {
+            f_cacheStatistics.hits += 1;
+        }
+        f_cacheStamp[slot] = f_cacheTick;
+        f_cacheLast = slot;
+        return;
+    }
+
+    // Missing glyph, then missing glyphs of the rest of the string
+    // Glyphs of the string already in the cache are kept
+    uint8_t characters[FONT_FLASH_CACHE_GLYPHS];
+    uint8_t number = 0;
+    uint8_t kept = 0;
+
+    characters[number] = character;
+    number += 1;
+
+    while ((index < length) and (number + kept < FONT_FLASH_CACHE_GLYPHS))
+    {
+        uint8_t next = f_getGlyph(utf8CodePoint(text, length, index)) - ' ';
+
+        slot = f_findGlyph(next);
+        if (slot < FONT_FLASH_CACHE_GLYPHS)
+        {
+            if (f_cacheStamp[slot] != f_cacheTick)
+            {
+                f_cacheStamp[slot] = f_cacheTick;
+                kept += 1;
+            }
+        }
+        else
+        {
+            uint8_t k = 0;
+            while ((k < number) and (characters[k] != next))
+            {
+                k += 1;
+            }
+            if (k == number)
+            {
+                characters[number] = next;
+                number += 1;
+            }
+        }
+    }
+
+    f_readGlyphs(characters, number);
+
+    f_cacheStatistics.misses += 1;
+    f_cacheLast = f_findGlyph(character);
+    f_cachePending[f_cacheLast] = false;
+}
+
+void hV_Font_Terminal::f_readGlyphs(uint8_t * characters, uint8_t number)
+{
+    uint8_t bytesPerColumn = (f_font.height + 7) / 8;
+
+    // Sort characters, so addresses are increasing
+    for (uint8_t i = 1; i < number; i += 1)
+    {
+        uint8_t value = characters[i];
+        uint8_t j = i;
+        while ((j > 0) and (characters[j - 1] > value))
+        {
+            characters[j] = characters[j - 1];
+            j -= 1;
+        }
+        characters[j] = value;
+    }
+
+    bool flagOpen = false;
+    uint32_t position = 0;
+
+    for (uint8_t k = 0; k < number; k += 1)
+    {
+        uint8_t character = characters[k];
+
+        // Least recently used slot, empty first
+        uint8_t victim = 0;
+        for (uint8_t slot = 0; slot < FONT_FLASH_CACHE_GLYPHS; slot += 1)
+        {
+            if (f_cacheFont[slot] == FONT_FLASH_EMPTY)
+            {
+                victim = slot;
+                break;
+            }
+            if (f_cacheStamp[slot] < f_cacheStamp[victim])
+            {
+                victim = slot;
+            }
+        }
+
+        f_cacheFont[victim] = f_fontSize;
+        f_cacheCharacter[victim] = character;
+        f_cacheStamp[victim] = f_cacheTick;
+        f_cachePending[victim] = true;
+
+        uint32_t start = f_flashTable + (uint32_t)f_flashColumn[character] * bytesPerColumn;
+        uint16_t size = (f_flashColumn[character + 1] - f_flashColumn[character]) * bytesPerColumn;
+        if (size > FONT_FLASH_GLYPH_SIZE)
+        {
+            size = FONT_FLASH_GLYPH_SIZE;
+        }
+
+        // Close glyph, same transaction
+        if (flagOpen and (start >= position) and (start - position <= FONT_FLASH_GAP))
+        {
+            f_flash.readNext(nullptr, start - position);
+            f_cacheStatistics.bytes += start - position;
+        }
+        else
+        {
+            if (flagOpen)
+            {
+                f_flash.readEnd();
+            }
+            f_flash.readBegin(start);
+            f_cacheStatistics.reads += 1;
+            flagOpen = true;
+        }
+
+        f_flash.readNext(f_cacheData[victim], size);
+        f_cacheStatistics.bytes += size;
+        position = start + size;
+    }
+
+    if (flagOpen)
+    {
+        f_flash.readEnd();
+    }
+}
+
+#endif // FONT_FLASH
+
 #endif // USE_FONT_TERMINAL
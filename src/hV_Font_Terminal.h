@@ -61,6 +61,19 @@
 #include "hV_Utilities_Common.h"
 #include "hV_Font.h"
 
+///
+/// @brief Number of characters in the font subset
+/// @see FONT_SUBSET
+///
+#define FONT_SUBSET_NUMBER (32 * (((FONT_SUBSET >> 0) & 0x01) + ((FONT_SUBSET >> 1) & 0x01) + \
+                                  ((FONT_SUBSET >> 2) & 0x01) + ((FONT_SUBSET >> 3) & 0x01) + \
+                                  ((FONT_SUBSET >> 4) & 0x01) + ((FONT_SUBSET >> 5) & 0x01) + \
+                                  ((FONT_SUBSET >> 6) & 0x01)))
+
+#if (FONT_SUBSET_NUMBER == 0)
+#error FONT_SUBSET is empty
+#endif // FONT_SUBSET_NUMBER
+
 ///
 /// @brief Biggest font size
 /// @details Based on the MCU, by default = 0
@@ -78,6 +91,36 @@
 #endif
 #endif
 
+#if (FONT_PROPORTIONAL == USE_FONT_PROPORTIONAL_YES)
+#include "Terminal8x12p.h"
+#include "Terminal12x16p.h"
+#endif // FONT_PROPORTIONAL
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+// External SPI Flash
+#include "hV_Memory_SPI.h"
+
+#if (hV_MEMORY_SPI_RELEASE < 830)
+#error Required hV_MEMORY_SPI_RELEASE 830
+#endif // hV_MEMORY_SPI_RELEASE
+
+#if (FONT_FLASH_CACHE_GLYPHS < 1)
+#error FONT_FLASH_CACHE_GLYPHS should be 1 or more
+#endif // FONT_FLASH_CACHE_GLYPHS
+
+///
+/// @brief Statistics of the glyph cache for fonts on SPI Flash
+/// @details hits + misses = number of glyphs drawn with a font on SPI Flash
+///
+struct fontCacheStatistics_s
+{
+    uint32_t hits; ///< glyphs found in the cache
+    uint32_t misses; ///< glyphs read from SPI Flash
+    uint32_t reads; ///< number of SPI transactions, including tables of columns
+    uint32_t bytes; ///< number of bytes read from SPI Flash, including skipped bytes
+};
+#endif // FONT_FLASH
+
 ///
 /// @brief Font enumeration
 /// @note Generated by hV_FontsFlash_Manage2
@@ -88,6 +131,10 @@ enum fontNumber_e
     Font_Terminal8x12,
     Font_Terminal12x16,
     Font_Terminal16x24,
+#if (FONT_PROPORTIONAL == USE_FONT_PROPORTIONAL_YES)
+    Font_Terminal8x12p, ///< proportional
+    Font_Terminal12x16p, ///< proportional
+#endif // FONT_PROPORTIONAL
 };
 
 ///
@@ -111,6 +158,7 @@ class hV_Font_Terminal
     ///
     /// @brief Select font
     /// @param font default = 0 = small, 1 = large
+    /// @note Added fonts are numbered after the Terminal fonts
     /// @warning Definition for this method is compulsory.
     /// @note Previously _setFontSize()
     ///
@@ -121,6 +169,7 @@ class hV_Font_Terminal
     /// @param fontName name of the font
     /// @return number of the font, 0 otherwise
     /// @warning Definition for this method is compulsory.
+    /// @note Proportional fonts generated by extras/bdf2pdls.py, numbered after the Terminal fonts
     /// @note Previously setFontSize()
     /// @n @b More: @ref Fonts
     ///
@@ -147,17 +196,57 @@ class hV_Font_Terminal
     ///
     void f_setFontSpaceY(uint8_t number = 1);
 
+    ///
+    /// @brief Set replacement character for unsupported code points
+    /// @param character character 32~255, default = '?'
+    ///
+    void f_setFontReplacement(uint8_t character = '?');
+
+    ///
+    /// @brief Map a Unicode code point to a character of the Terminal fonts
+    /// @param codePoint Unicode code point, from utf8CodePoint()
+    /// @return character 32~255, or replacement character if not available
+    /// @note 0x20~0xff are ISO-8859-1, 0x80 is the Euro sign
+    /// @note Characters outside the FONT_SUBSET are not available
+    /// @note For sparse fonts, character 32 + glyph from the ranges of code points
+    ///
+    uint8_t f_getGlyph(uint32_t codePoint);
+
+    ///
+    /// @brief Find a code point in the ranges of a sparse font
+    /// @param codePoint Unicode code point
+    /// @return character 32~255, 0 if not available
+    /// @note Same range as the previous code point first, then binary search
+    ///
+    uint8_t f_findRange(uint32_t codePoint);
+
+    ///
+    /// @brief Number of characters of an UTF-8 string
+    /// @param text UTF-8 string
+    /// @param length number of bytes to consider
+    /// @return number of characters
+    ///
+    uint16_t f_countGlyphs(const char * text, uint16_t length);
+
     ///
     /// @brief Character size, x-axis
     /// @param character character to evaluate, default = 0 = font general size
     /// @return horizontal size of character for current font, in pixels
     /// @note With setSpaceX included
-    /// @note In variable font, each character has a specific size. The general size is indicative.
+    /// @note In variable font, each character has a specific size. The general size is the size of the widest character.
     /// @note Previously fontSizeX()
     /// @n @b More: @ref Fonts
     ///
     uint16_t f_characterSizeX(uint8_t character = 0x00);
 
+    ///
+    /// @brief Width of a character
+    /// @param character character - 32, 0~223
+    /// @return width in pixels, without spaceX, and index of first byte in the table
+    /// @note O(1) for both monospaced and proportional fonts
+    ///
+    width_s f_getCharacterWidth(uint8_t character);
+
     ///
     /// @brief Character size, y-axis
     /// @return vertical size for current font, in pixels
@@ -169,19 +258,24 @@ class hV_Font_Terminal
     ///
     /// @brief String size, x-axis
     /// @param text string to evaluate
+    /// @param length number of bytes to consider
     /// @return horizontal size of the string for current font, in pixels
+    /// @note Same as drawn, monospaced glyphs include spacing, proportional glyphs add spaceX
     /// @n @b More: @ref Fonts
     ///
-    uint16_t f_stringSizeX(STRING_CONST_TYPE text);
+    uint16_t f_stringSizeX(const char * text, uint16_t length);
 
     ///
     /// @brief Number of characters to fit a size, x-axis
     /// @param text string to evaluate
+    /// @param length number of bytes to consider
     /// @param pixels number of pixels to fit in
-    /// @return number of characters to be displayed inside the pixels
+    /// @return number of bytes of the characters to be displayed inside the pixels
+    /// @note Equal to the number of characters for ASCII strings
+    /// @note Exact, consistent with f_stringSizeX()
     /// @n @b More: @ref Fonts
     ///
-    uint8_t f_stringLengthToFitX(STRING_CONST_TYPE text, uint16_t pixels);
+    uint8_t f_stringLengthToFitX(const char * text, uint16_t length, uint16_t pixels);
 
     ///
     /// @brief Number of fonts
@@ -211,6 +305,75 @@ class hV_Font_Terminal
     ///
     uint8_t f_getCharacter(uint8_t character, uint16_t index);
 
+    ///
+    /// @brief Row of a character in the font tables
+    /// @param character character - 32, 0~223
+    /// @return row in the tables for the FONT_SUBSET
+    /// @note The character should be available, see f_getGlyph()
+    ///
+    uint8_t f_getCharacterRow(uint8_t character);
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+    ///
+    /// @brief Register a font on SPI Flash
+    /// @param address address of the font on SPI Flash
+    /// @return number of the font, 0 otherwise
+    /// @note f_flash should be initialised before
+    ///
+    uint8_t f_addFontFlash(uint32_t address);
+
+    ///
+    /// @brief Get a glyph of the font on SPI Flash into the cache
+    /// @param character character - 32, 0~223
+    /// @param text UTF-8 string for read-ahead
+    /// @param length number of bytes of the string
+    /// @param index first byte after the character
+    /// @note On a miss, the missing glyphs of the rest of the string are read together
+    ///
+    void f_loadGlyph(uint8_t character, const char * text, uint16_t length, uint16_t index);
+
+    ///
+    /// @brief Slot of a glyph in the cache
+    /// @param character character - 32, 0~223
+    /// @return slot, FONT_FLASH_CACHE_GLYPHS if not found
+    ///
+    uint8_t f_findGlyph(uint8_t character);
+
+    ///
+    /// @brief Read missing glyphs from SPI Flash into the cache
+    /// @param characters list of characters - 32, sorted on return
+    /// @param number number of characters
+    ///
+    void f_readGlyphs(uint8_t * characters, uint8_t number);
+
+    hV_Memory_SPI f_flash; ///< external SPI Flash
+
+    ///
+    /// @name Variables for fonts on SPI Flash
+    /// @{
+    ///
+    uint32_t f_flashAddress[MAX_FONT_ADDED]; ///< addresses of the fonts, per added font
+    range_s f_flashRange[FONT_FLASH_RANGES]; ///< table of ranges of the selected font
+    uint16_t f_flashColumn[224 + 1]; ///< table of columns of the selected font
+    uint32_t f_flashTable; ///< address of the table of the selected font
+    bool f_fontFlash; ///< selected font on SPI Flash
+    /// @}
+
+    ///
+    /// @name Variables for the LRU glyph cache
+    /// @{
+    ///
+    uint8_t f_cacheFont[FONT_FLASH_CACHE_GLYPHS]; ///< font of each slot, 0xff = empty
+    uint8_t f_cacheCharacter[FONT_FLASH_CACHE_GLYPHS]; ///< character of each slot
+    uint16_t f_cacheStamp[FONT_FLASH_CACHE_GLYPHS]; ///< last use of each slot
+    bool f_cachePending[FONT_FLASH_CACHE_GLYPHS]; ///< read ahead, not yet drawn
+    uint8_t f_cacheData[FONT_FLASH_CACHE_GLYPHS][FONT_FLASH_GLYPH_SIZE]; ///< glyphs
+    uint16_t f_cacheTick; ///< clock for last use
+    uint8_t f_cacheLast; ///< slot of the last glyph
+    fontCacheStatistics_s f_cacheStatistics; ///< statistics
+    /// @}
+#endif // FONT_FLASH
+
     ///
     /// @name Variables for font management
     /// @{
@@ -221,6 +384,10 @@ class hV_Font_Terminal
     uint8_t f_fontSpaceX; ///< pixels between two characters, horizontal axis
     uint8_t f_fontSpaceY; ///< pixels between two characters, vertical axis
     bool f_fontSolid; ///< opaque print
+    uint8_t f_fontReplacement; ///< character for unsupported code points
+    font_s f_addedFont[MAX_FONT_ADDED]; ///< fonts added with addFont() or addFontFlash()
+    uint8_t f_addedNumber; ///< number of added fonts
+    uint8_t f_rangeLast; ///< range of the previous code point, sparse font
     /// @}
 };
 /// @endcond
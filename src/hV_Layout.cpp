@@ -0,0 +1,289 @@
+//
+// hV_Layout.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 21 Jun 2025
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence All rights reserved
+//
+// Release 830: Initial release
+//
+
+// Library header
+#include "hV_Layout.h"
+
+// Checksum of the text, FNV-1a
+static uint32_t layoutChecksum(const char * text, uint16_t length)
+{
+    uint32_t result = 0x811c9dc5;
+    for (uint16_t index = 0; index < length; index += 1)
+    {
+        result ^= (uint8_t)text[index];
+        result *= 0x01000193;
+    }
+    return result;
+}
+
+hV_Layout::hV_Layout(hV_Screen_Buffer * screen)
+{
+    m_screen = screen;
+    m_text = nullptr;
+    m_length = 0;
+    m_checksum = 0;
+    m_x0 = 0;
+    m_y0 = 0;
+    m_dx = 0;
+    m_dy = 0;
+    m_horizontal = ALIGN_LEFT;
+    m_vertical = ALIGN_TOP;
+    m_spaceY = 1;
+    m_font = 0;
+    m_flagValid = false;
+    m_lines = 0;
+    m_height = 0;
+    m_overflow = 0;
+}
+
+void hV_Layout::setBox(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    if ((x0 != m_x0) or (y0 != m_y0) or (dx != m_dx) or (dy != m_dy))
+    {
+        m_x0 = x0;
+        m_y0 = y0;
+        m_dx = dx;
+        m_dy = dy;
+        m_flagValid = false;
+    }
+}
+
+void hV_Layout::setAlignment(uint8_t horizontal, uint8_t vertical)
+{
+    if ((horizontal != m_horizontal) or (vertical != m_vertical))
+    {
+        m_horizontal = horizontal;
+        m_vertical = vertical;
+        m_flagValid = false;
+    }
+}
+
+void hV_Layout::setSpaceY(uint8_t number)
+{
+    if (number != m_spaceY)
+    {
+        m_spaceY = number;
+        m_flagValid = false;
+    }
+}
+
+void hV_Layout::setText(const char * text)
+{
+    setText(text, strlen(text));
+}
+
+void hV_Layout::setText(const char * text, uint16_t length)
+{
+    uint32_t checksum = layoutChecksum(text, length);
+
+    if ((text != m_text) or (length != m_length) or (checksum != m_checksum))
+    {
+        m_text = text;
+        m_length = length;
+        m_checksum = checksum;
+        m_flagValid = false;
+    }
+}
+
+void hV_Layout::invalidate()
+{
+    m_flagValid = false;
+}
+
+bool hV_Layout::update()
+{
+    if (m_flagValid and (m_font == m_screen->getFont()))
+    {
+        return false;
+    }
+
+    m_compute();
+    return true;
+}
+
+void hV_Layout::m_compute()
+{
+    m_font = m_screen->getFont();
+    m_lines = 0;
+    m_height = 0;
+    m_overflow = 0;
+    m_flagValid = true;
+
+    if (m_text == nullptr)
+    {
+        return;
+    }
+
+    uint16_t sizeY = m_screen->characterSizeY();
+    uint16_t index = 0;
+
+    while (index < m_length)
+    {
+        // No room for another line
+        if ((m_lines >= LAYOUT_MAX_LINES) or (m_height + sizeY > m_dy))
+        {
+            m_overflow = m_length - index;
+            break;
+        }
+
+        uint16_t start = index;
+        uint16_t end = index; // end of the last word that fits
+        uint16_t width = 0; // width up to end
+
+        // Add words, with the spaces before, while they fit
+        while ((index < m_length) and (m_text[index] != '\n'))
+        {
+            uint16_t wordEnd = index;
+            while ((wordEnd < m_length) and (m_text[wordEnd] == ' '))
+            {
+                wordEnd += 1;
+            }
+            while ((wordEnd < m_length) and (m_text[wordEnd] != ' ') and (m_text[wordEnd] != '\n'))
+            {
+                wordEnd += 1;
+            }
+
+            uint16_t wordWidth = m_screen->stringSizeX(m_text + index, wordEnd - index);
+            if (width + wordWidth <= m_dx)
+            {
+                width += wordWidth;
+                end = wordEnd;
+                index = wordEnd;
+            }
+            else
+            {
+                // First word too long, broken
+                if (end == start)
+                {
+                    uint16_t bytes = m_screen->stringLengthToFitX(m_text + index, wordEnd - index, m_dx);
+                    if (bytes == 0)
+                    {
+                        // At least one character, even if wider than the box
+                        uint16_t next = index;
+                        utf8CodePoint(m_text, m_length, next);
+                        bytes = next - index;
+                    }
+                    end = index + bytes;
+                    width = m_screen->stringSizeX(m_text + start, end - start);
+                    index = end;
+                }
+                break;
+            }
+        }
+
+        m_line[m_lines].start = start;
+        m_line[m_lines].length = end - start;
+        m_line[m_lines].x = m_x0;
+        if (width < m_dx)
+        {
+            if (m_horizontal == ALIGN_CENTER)
+            {
+                m_line[m_lines].x += (m_dx - width) / 2;
+            }
+            else if (m_horizontal == ALIGN_RIGHT)
+            {
+                m_line[m_lines].x += m_dx - width;
+            }
+        }
+        m_line[m_lines].y = m_height;
+        m_height += sizeY + m_spaceY;
+        m_lines += 1;
+
+        // Explicit line feed, or spaces at wrap
+        if ((index < m_length) and (m_text[index] == '\n'))
+        {
+            index += 1;
+        }
+        else
+        {
+            while ((index < m_length) and (m_text[index] == ' '))
+            {
+                index += 1;
+            }
+        }
+    }
+
+    if (m_lines > 0)
+    {
+        m_height -= m_spaceY;
+    }
+
+    // Vertical alignment
+    uint16_t y = m_y0;
+    if (m_vertical == ALIGN_MIDDLE)
+    {
+        y += (m_dy - m_height) / 2;
+    }
+    else if (m_vertical == ALIGN_BOTTOM)
+    {
+        y += m_dy - m_height;
+    }
+
+    for (uint8_t line = 0; line < m_lines; line += 1)
+    {
+        m_line[line].y += y;
+    }
+}
+
+void hV_Layout::draw(uint16_t textColour, uint16_t backColour)
+{
+    update();
+
+    for (uint8_t line = 0; line < m_lines; line += 1)
+    {
+        m_screen->gText(m_line[line].x, m_line[line].y, m_text + m_line[line].start, m_line[line].length, textColour, backColour);
+    }
+}
+
+void hV_Layout::clear(uint16_t colour)
+{
+    bool oldPenSolid = m_screen->getPenSolid();
+    m_screen->setPenSolid(true);
+    m_screen->dRectangle(m_x0, m_y0, m_dx, m_dy, colour);
+    m_screen->setPenSolid(oldPenSolid);
+}
+
+uint8_t hV_Layout::getLines()
+{
+    update();
+    return m_lines;
+}
+
+layoutLine_s hV_Layout::getLine(uint8_t line)
+{
+    update();
+    layoutLine_s result = { 0, 0, 0, 0 };
+
+    if (line < m_lines)
+    {
+        result = m_line[line];
+    }
+
+    return result;
+}
+
+uint16_t hV_Layout::getHeight()
+{
+    update();
+    return m_height;
+}
+
+uint16_t hV_Layout::getOverflow()
+{
+    update();
+    return m_overflow;
+}
+
@@ -0,0 +1,212 @@
+///
+/// @file hV_Layout.h
+/// @brief Text layout with word wrap and alignment
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Text broken into lines inside a box
+/// * Word wrap on spaces, explicit line feed with \n, long words broken
+/// * Horizontal alignment: ALIGN_LEFT, ALIGN_CENTER, ALIGN_RIGHT
+/// * Vertical alignment: ALIGN_TOP, ALIGN_MIDDLE, ALIGN_BOTTOM
+/// * Overflow reported as number of bytes not displayed
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+#ifndef hV_LAYOUT_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_LAYOUT_RELEASE 830
+
+///
+/// @brief Line of a layout
+/// @details Bytes of the text and position of the line on the screen
+///
+struct layoutLine_s
+{
+    uint16_t start; ///< first byte of the line in the text
+    uint16_t length; ///< number of bytes of the line
+    uint16_t x; ///< position of the line, x-axis
+    uint16_t y; ///< position of the line, y-axis
+};
+
+// Objects
+//
+///
+/// @brief Class for text layout
+/// @details Lines and positions are computed once and kept,
+/// and computed again only when the text, the font, the box or the alignment change
+///
+/// @note The text is not copied and should remain available,
+/// call setText() again after modifying its content
+/// @note Call invalidate() after setFontSpaceX()
+///
+/// @n Example
+/// @code {.cpp}
+/// hV_Layout myLayout(&myScreen);
+/// myLayout.setBox(0, 0, 160, 60);
+/// myLayout.setAlignment(ALIGN_CENTER, ALIGN_MIDDLE);
+/// myLayout.setText("Battery low\nPlease charge the device");
+/// myLayout.draw();
+/// @endcode
+///
+class hV_Layout
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on and to measure the text with
+    ///
+    hV_Layout(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the box
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width, x-axis
+    /// @param dy height, y-axis
+    ///
+    void setBox(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Set the alignment
+    /// @param horizontal ALIGN_LEFT, ALIGN_CENTER or ALIGN_RIGHT, default = ALIGN_LEFT
+    /// @param vertical ALIGN_TOP, ALIGN_MIDDLE or ALIGN_BOTTOM, default = ALIGN_TOP
+    ///
+    void setAlignment(uint8_t horizontal = ALIGN_LEFT, uint8_t vertical = ALIGN_TOP);
+
+    ///
+    /// @brief Set additional pixels between two lines
+    /// @param number of pixels, default = 1
+    ///
+    void setSpaceY(uint8_t number = 1);
+
+    ///
+    /// @brief Set the text
+    /// @param text null-terminated UTF-8 string
+    /// @note Same text with same content keeps the layout
+    ///
+    void setText(const char * text);
+
+    ///
+    /// @brief Set the text with length
+    /// @param text UTF-8 string, not necessarily null-terminated
+    /// @param length number of bytes
+    /// @note Same text with same content keeps the layout
+    ///
+    void setText(const char * text, uint16_t length);
+
+    ///
+    /// @brief Force a new layout at next update() or draw()
+    ///
+    void invalidate();
+
+    ///
+    /// @brief Compute the layout if needed
+    /// @return true if computed again, false if kept
+    ///
+    bool update();
+
+    ///
+    /// @brief Draw the text
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @note Calls update() first
+    ///
+    void draw(uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Clear the box
+    /// @param colour 16-bit colour, default = white
+    /// @note Pen is set to not solid after
+    ///
+    void clear(uint16_t colour = myColours.white);
+
+    ///
+    /// @brief Number of lines
+    /// @return number of lines displayed
+    ///
+    uint8_t getLines();
+
+    ///
+    /// @brief Details of a line
+    /// @param line line number, 0..getLines()-1
+    /// @return first byte, length and position of the line
+    ///
+    layoutLine_s getLine(uint8_t line);
+
+    ///
+    /// @brief Height of the text
+    /// @return height of the lines displayed, in pixels
+    ///
+    uint16_t getHeight();
+
+    ///
+    /// @brief Overflow
+    /// @return number of bytes not displayed, 0 = no overflow
+    ///
+    uint16_t getOverflow();
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Break the text into lines
+    ///
+    void m_compute();
+
+    hV_Screen_Buffer * m_screen;
+    const char * m_text;
+    uint16_t m_length;
+    uint32_t m_checksum;
+    uint16_t m_x0, m_y0, m_dx, m_dy;
+    uint8_t m_horizontal, m_vertical;
+    uint8_t m_spaceY;
+    uint8_t m_font;
+    bool m_flagValid;
+
+    layoutLine_s m_line[LAYOUT_MAX_LINES];
+    uint8_t m_lines;
+    uint16_t m_height;
+    uint16_t m_overflow;
+
+    /// @endcond
+};
+
+#endif // hV_LAYOUT_RELEASE
+
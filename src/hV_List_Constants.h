@@ -68,6 +68,66 @@
 #define UPDATE_GLOBAL 0x01 ///< Global update, default
 #define UPDATE_FAST 0x02 ///< Fast update
 #define UPDATE_PARTIAL 0x03 ///< Partial update, deprecated
+#define UPDATE_REGENERATE 0x04 ///< Black and white cycle, then global update
+/// @}
+
+///
+/// @name Reasons for refresh decision
+/// @see refreshDecision_s
+/// @{
+#define REFRESH_REASON_DEFAULT 0x00 ///< Default mode of the policy
+#define REFRESH_REASON_UNCHANGED 0x01 ///< No pixel toggled, no update
+#define REFRESH_REASON_TEMPERATURE 0x02 ///< Temperature out of fast update range
+#define REFRESH_REASON_COUNTER 0x03 ///< Maximum number of fast updates reached
+#define REFRESH_REASON_TOGGLED 0x04 ///< Maximum of toggled pixels reached
+#define REFRESH_REASON_GLOBAL 0x05 ///< Maximum number of global updates reached
+/// @}
+
+///
+/// @name Alignment for numbers and text
+/// @note Numbers are sequential and exclusive
+/// @see gNumber(), hV_Layout
+/// @{
+#define ALIGN_LEFT 0x00 ///< Padding after the number
+#define ALIGN_CENTER 0x01 ///< Padding on both sides
+#define ALIGN_RIGHT 0x02 ///< Padding before the number, default
+/// @}
+
+///
+/// @name Vertical alignment for text
+/// @note Numbers are sequential and exclusive
+/// @see hV_Layout
+/// @{
+#define ALIGN_TOP 0x00 ///< Lines from the top, default
+#define ALIGN_MIDDLE 0x01 ///< Lines centred vertically
+#define ALIGN_BOTTOM 0x02 ///< Lines up to the bottom
+/// @}
+
+///
+/// @name Composition of background and overlay
+/// @note Numbers are sequential and exclusive
+/// @see saveBackground()
+/// @{
+#define BACKGROUND_OR 0x01 ///< Black pixels of the overlay over the background, overlay cleared in white, default
+#define BACKGROUND_AND 0x02 ///< White pixels of the overlay over the background, overlay cleared in black
+/// @}
+
+///
+/// @name Downsampling of charts
+/// @note Numbers are sequential and exclusive
+/// @see hV_WidgetChart
+/// @{
+#define CHART_MINMAX 0x01 ///< Minimum and maximum per column, default
+#define CHART_LTTB 0x02 ///< Largest triangle three buckets, one sample per column
+/// @}
+
+///
+/// @name Ordered dithering
+/// @note Numbers are sequential and exclusive
+/// @see setDither()
+/// @{
+#define DITHER_4X4 0x01 ///< Bayer matrix 4x4, 17 levels, default
+#define DITHER_8X8 0x02 ///< Bayer matrix 8x8, 65 levels
 /// @}
 
 ///
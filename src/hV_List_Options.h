@@ -7,13 +7,26 @@
 ///
 /// @n Content
 /// * 3- Font mode, internal MCU for basic edition
+/// * 3.1- Font subset
+/// * 3.2- Proportional fonts
+/// * 3.3- Fonts on external SPI Flash
 /// * 4- Maximum number of fonts
+/// * 4.1- Maximum number of added fonts
 /// * 5- SRAM memory, internal MCU for basic edition
+/// * 5.1- External SPI memory
+/// * 5.2- Display list
+/// * 5.3- Background layer
+/// * 5.4- Page cache
+/// * 5.5- Flood fill
 /// * 6- Use self for basic edition
 /// * 7- Touch mode, activated or not
 /// * 8- Haptic feedback mode, not implemented
 /// * 9. Set GPIO expander mode, not implemented
 /// * 10. String object for basic edition
+/// * 10.1- Buffer for formatted text
+/// * 10.2- Text layout
+/// * 10.3- Text field
+/// * 10.4- Time series
 /// * 11. Set storage mode, not implemented
 /// * 12. Set debug options, not implemented
 /// * 13. Select EXT board
@@ -79,6 +92,74 @@
 #define FONT_MODE USE_FONT_TERMINAL ///< Selected option
 /// @}
 
+///
+/// @name 3.1- Set font subset
+/// @details Only for FONT_MODE == USE_FONT_TERMINAL, blocks of 32 characters included at compilation
+/// * 0x20~0x3f: symbols and digits, including space ! % + - . / 0~9 :
+/// * 0x40~0x5f: uppercase letters
+/// * 0x60~0x7f: lowercase letters
+/// * 0x80~0x9f: extended characters, including Euro sign
+/// * 0xa0~0xbf: ISO-8859-1 symbols, including degree sign
+/// * 0xc0~0xdf and 0xe0~0xff: ISO-8859-1 accented letters
+///
+/// @note Characters outside the subset are replaced, see setFontReplacement()
+/// @warning The replacement character, by default '?', should be part of the subset
+/// @n Example for numbers with units: FONT_SUBSET_SYMBOLS | FONT_SUBSET_UPPERCASE | FONT_SUBSET_LATIN1_A0
+///
+/// @{
+#define FONT_SUBSET_SYMBOLS 0x01 ///< 0x20~0x3f
+#define FONT_SUBSET_UPPERCASE 0x02 ///< 0x40~0x5f
+#define FONT_SUBSET_LOWERCASE 0x04 ///< 0x60~0x7f
+#define FONT_SUBSET_EXTENDED 0x08 ///< 0x80~0x9f
+#define FONT_SUBSET_LATIN1_A0 0x10 ///< 0xa0~0xbf
+#define FONT_SUBSET_LATIN1_C0 0x20 ///< 0xc0~0xdf
+#define FONT_SUBSET_LATIN1_E0 0x40 ///< 0xe0~0xff
+#define FONT_SUBSET_ASCII 0x07 ///< 0x20~0x7f
+#define FONT_SUBSET_ALL 0x7f ///< 0x20~0xff
+
+#define FONT_SUBSET FONT_SUBSET_ALL ///< Selected option
+/// @}
+
+///
+/// @name 3.2- Set proportional fonts
+/// @details Only for FONT_MODE == USE_FONT_TERMINAL
+/// * Font_Terminal8x12p, proportional variant of Terminal8x12e
+/// * Font_Terminal12x16p, proportional variant of Terminal12x16e
+///
+/// @note Digits keep the same width for numbers to align
+/// @note Generated by extras/bdf2pdls.py, which also converts BDF fonts
+/// @note Sparse fonts include only selected code points, eg. Central European or Cyrillic,
+/// with a table of ranges, and are added with addFont(), see MAX_FONT_ADDED
+///
+/// @{
+#define USE_FONT_PROPORTIONAL_NONE 0 ///< Monospaced fonts only
+#define USE_FONT_PROPORTIONAL_YES 1 ///< Add proportional fonts
+
+#define FONT_PROPORTIONAL USE_FONT_PROPORTIONAL_NONE ///< Selected option
+/// @}
+
+///
+/// @name 3.3- Set fonts on external SPI Flash
+/// @details Only for FONT_MODE == USE_FONT_TERMINAL, in addition to the Terminal fonts
+/// * Fonts generated by extras/bdf2pdls.py with --binary and uploaded to the SPI Flash selected by flashCS
+/// * Glyphs read on demand through a LRU cache of FONT_FLASH_CACHE_GLYPHS glyphs in MCU internal SRAM
+/// * Missing glyphs of a string read together, with one SPI transaction for close glyphs
+///
+/// @note Fonts on SPI Flash require addFontFlash(), see MAX_FONT_ADDED
+/// @note Selecting a font on SPI Flash reads its table of columns, 2 bytes per character
+/// @warning The SPI bus should remain on while drawing text with a font on SPI Flash
+///
+/// @{
+#define USE_FONT_FLASH_NONE 0 ///< Terminal fonts only
+#define USE_FONT_FLASH_YES 1 ///< Add fonts on external SPI Flash
+
+#define FONT_FLASH USE_FONT_FLASH_NONE ///< Selected option
+#define FONT_FLASH_RANGES 8 ///< Maximum number of ranges of code points per font
+#define FONT_FLASH_CACHE_GLYPHS 8 ///< Number of glyphs in the cache
+#define FONT_FLASH_GLYPH_SIZE 192 ///< Maximum size of a glyph, width x bytes per column, eg. 32 x 6 for 48 pixels high
+#define FONT_FLASH_GAP 16 ///< Maximum number of bytes skipped between two glyphs in the same SPI transaction
+/// @}
+
 ///
 /// @brief 4- Maximum number of fonts
 /// @details With MCU Flash, based on available memory, check performed at compilation
@@ -94,6 +175,16 @@
 #define MAX_FONT_SIZE 64
 #endif
 
+///
+/// @brief 4.1- Maximum number of added fonts
+/// @details Only for FONT_MODE == USE_FONT_TERMINAL
+/// * Proportional or sparse fonts generated by extras/bdf2pdls.py, with addFont()
+/// * Fonts on external SPI Flash, with addFontFlash()
+///
+/// @note Added fonts are numbered after the Terminal fonts
+///
+#define MAX_FONT_ADDED 4
+
 ///
 /// @name 5- Set SRAM memory
 /// @details From internal MCU or external SPI
@@ -102,12 +193,103 @@
 /// * Evaluation edition: MCU internal or SPI external SRAM
 /// * Viewer edition: MCU internal SRAM
 ///
+/// @note USE_EXTERNAL_SPI keeps the next and previous frame-buffers on an external SPI SRAM or FRAM
+/// selected by flashCSS, with a write-back cache of lines in MCU internal SRAM
+/// @warning With USE_EXTERNAL_SPI, an SPI SRAM should not be powered by panelPower, otherwise use an SPI FRAM
+/// @note USE_CHARACTER_CELLS keeps a grid of character cells with Terminal6x8 font instead of a frame-buffer,
+/// rendered at flush only; text only, no graphics
+///
 /// @{
 #define USE_INTERNAL_MCU 1 ///< Use MCU internal
+#define USE_EXTERNAL_SPI 2 ///< Use external SPI SRAM or FRAM
+#define USE_CHARACTER_CELLS 3 ///< Use MCU internal for character cells, text only
 
 #define SRAM_MODE USE_INTERNAL_MCU ///< Selected option
 /// @}
 
+///
+/// @name 5.1- External SPI memory
+/// @details Only for SRAM_MODE == USE_EXTERNAL_SPI
+/// * 23LC1024-like SPI SRAM, 3 address bytes, sequential mode
+/// * 23K256-like SPI SRAM, 2 address bytes, sequential mode
+/// * MB85RS-like SPI FRAM, 2 or 3 address bytes, write enable
+///
+/// @note EXTERNAL_SPI_FLASH is read-only and reserved for the fonts, see FONT_FLASH
+///
+/// @{
+#define EXTERNAL_SPI_SRAM 1 ///< SPI SRAM
+#define EXTERNAL_SPI_FRAM 2 ///< SPI FRAM
+#define EXTERNAL_SPI_FLASH 3 ///< SPI Flash, read only
+
+#define EXTERNAL_SPI_KIND EXTERNAL_SPI_SRAM ///< Selected option
+#define EXTERNAL_SPI_ADDRESS_BYTES 3 ///< Number of address bytes, 2 or 3
+#define EXTERNAL_SPI_CACHE_LINES 8 ///< Number of lines of the write-back cache
+/// @}
+
+///
+/// @name 5.2- Display list
+/// @details Primitives recorded into a list instead of drawn immediately, then rasterised at flush()
+/// * Commands covered by a later fill dropped, adjacent fills and texts merged
+/// * List compared with the previous one, only the area changed rasterised again
+/// * Same list rasterised again after setOrientation(), without drawing again
+///
+/// @note Each list requires DISPLAY_LIST_SIZE x 24 + DISPLAY_LIST_TEXT bytes, two lists for current and previous
+/// @note Not available with USE_CHARACTER_CELLS
+///
+/// @{
+#define USE_DISPLAY_LIST_NONE 0 ///< Primitives drawn immediately
+#define USE_DISPLAY_LIST_YES 1 ///< Add display list, with setDisplayList()
+
+#define DISPLAY_LIST USE_DISPLAY_LIST_NONE ///< Selected option
+#define DISPLAY_LIST_SIZE 32 ///< Number of commands per list
+#define DISPLAY_LIST_TEXT 256 ///< Number of bytes for the texts per list
+/// @}
+
+///
+/// @name 5.3- Background layer
+/// @details Static background saved once, composed with the frame-buffer as overlay at each flush()
+/// * Background compressed into BACKGROUND_SIZE bytes of MCU internal SRAM,
+/// as difference with the line before then run-length encoding
+/// * Composition with 32-bit words, OR or AND, while sending the next frame
+///
+/// @note Only with SRAM_MODE == USE_INTERNAL_MCU
+///
+/// @{
+#define USE_BACKGROUND_NONE 0 ///< Frame-buffer only
+#define USE_BACKGROUND_YES 1 ///< Add background layer, with saveBackground()
+
+#define BACKGROUND_MODE USE_BACKGROUND_NONE ///< Selected option
+#define BACKGROUND_SIZE 2048 ///< Number of bytes for the compressed background
+/// @}
+
+///
+/// @name 5.4- Page cache
+/// @details Pages drawn once, kept compressed, then restored into the frame-buffer
+/// * Page identified by number and version of its content
+/// * Pages compressed as difference with the line before then run-length encoding
+/// * Least recently used pages removed when PAGE_CACHE_SIZE bytes or PAGE_CACHE_PAGES pages are used
+///
+/// @note Only with SRAM_MODE == USE_INTERNAL_MCU
+/// @note MCU internal SRAM only, as external SPI Flash is read-only
+///
+/// @{
+#define USE_PAGE_CACHE_NONE 0 ///< Pages drawn each time
+#define USE_PAGE_CACHE_YES 1 ///< Add page cache, with savePage() and loadPage()
+
+#define PAGE_CACHE USE_PAGE_CACHE_NONE ///< Selected option
+#define PAGE_CACHE_SIZE 4096 ///< Number of bytes for the compressed pages
+#define PAGE_CACHE_PAGES 4 ///< Number of pages
+/// @}
+
+///
+/// @name 5.5- Flood fill
+/// @details Maximum number of seeds pending for floodFill(), 4 bytes per seed, on the stack
+/// @note Seeds beyond are dropped and the area is partially filled
+///
+/// @{
+#define FLOOD_FILL_STACK 64 ///< Number of seeds
+/// @}
+
 ///
 /// @name 6- Use virtual object
 /// @details From hV_Screen_Virtual.h for extended compability
@@ -181,6 +363,47 @@
 #define STRING_MODE USE_STRING_OBJECT
 /// @}
 
+///
+/// @name 10.1- Buffer for formatted text
+/// @details Size of the stack buffer used by gTextf(), including the null terminator
+/// @note Longer formatted texts are truncated
+///
+/// @{
+#define TEXT_FORMAT_SIZE 64 ///< Number of characters
+/// @}
+
+///
+/// @name 10.2- Text layout
+/// @details Maximum number of lines of a hV_Layout object, 8 bytes per line
+/// @note Lines beyond are reported as overflow
+///
+/// @{
+#define LAYOUT_MAX_LINES 8 ///< Number of lines
+/// @}
+
+///
+/// @name 10.3- Text field
+/// @details Maximum number of character cells of a hV_TextField object, 4 bytes per cell
+/// @note Characters beyond are not displayed
+///
+/// @{
+#define TEXT_FIELD_MAX_CELLS 16 ///< Number of cells
+/// @}
+
+///
+/// @name 10.4- Time series
+/// @details Ring buffers of a hV_TimeSeries object
+/// * Level 0: samples, 2 bytes per sample
+/// * Levels 1 and more: minimum, maximum and mean of TIME_SERIES_FACTOR entries of the level below, 6 bytes per entry
+///
+/// @note Each level keeps the last TIME_SERIES_SIZE entries
+///
+/// @{
+#define TIME_SERIES_SIZE 64 ///< Number of entries per level
+#define TIME_SERIES_LEVELS 3 ///< Number of levels, including samples, 2 or more
+#define TIME_SERIES_FACTOR 8 ///< Number of entries per entry of the level above
+/// @}
+
 ///
 /// @name 11- Storage mode
 /// * Basic edition: none
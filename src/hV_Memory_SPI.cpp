@@ -0,0 +1,150 @@
+//
+// hV_Memory_SPI.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 21 Jun 2025
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence All rights reserved
+//
+// Release 830: Initial release
+// Release 830: Added read-only SPI Flash and sequential read
+//
+
+// Library header
+#include "hV_Memory_SPI.h"
+
+// Commands, common to SPI SRAM, FRAM and Flash
+#define MEMORY_WRITE_STATUS 0x01 // SRAM WRMR, FRAM WRSR
+#define MEMORY_WRITE 0x02
+#define MEMORY_READ 0x03
+#define MEMORY_WRITE_ENABLE 0x06 // FRAM only
+#define MEMORY_MODE_SEQUENTIAL 0x40 // SRAM only
+#define MEMORY_RELEASE_POWER_DOWN 0xab // Flash only
+
+hV_Memory_SPI::hV_Memory_SPI()
+{
+    m_pinCS = NOT_CONNECTED;
+    m_kind = 0;
+    m_addressBytes = 3;
+}
+
+bool hV_Memory_SPI::begin(uint8_t pinCS, uint8_t kind, uint8_t addressBytes)
+{
+    if ((pinCS == NOT_CONNECTED) or (addressBytes < 2) or (addressBytes > 3))
+    {
+        return RESULT_ERROR;
+    }
+
+    m_pinCS = pinCS;
+    m_kind = kind;
+    m_addressBytes = addressBytes;
+
+    pinMode(m_pinCS, OUTPUT);
+    digitalWrite(m_pinCS, HIGH); // Unselect
+
+    if (m_kind == EXTERNAL_SPI_SRAM)
+    {
+        // Sequential mode, address rolls over the whole memory
+        digitalWrite(m_pinCS, LOW); // Select
+        hV_HAL_SPI_transfer(MEMORY_WRITE_STATUS);
+        hV_HAL_SPI_transfer(MEMORY_MODE_SEQUENTIAL);
+        digitalWrite(m_pinCS, HIGH); // Unselect
+    }
+    else if (m_kind == EXTERNAL_SPI_FLASH)
+    {
+        // Flash may be in deep power-down mode, tRES1 = 3 us
+        digitalWrite(m_pinCS, LOW); // Select
+        hV_HAL_SPI_transfer(MEMORY_RELEASE_POWER_DOWN);
+        digitalWrite(m_pinCS, HIGH); // Unselect
+        delayMicroseconds(5);
+    }
+
+    return RESULT_SUCCESS;
+}
+
+void hV_Memory_SPI::m_start(uint8_t command, uint32_t address)
+{
+    if ((command == MEMORY_WRITE) and (m_kind == EXTERNAL_SPI_FRAM))
+    {
+        digitalWrite(m_pinCS, LOW); // Select
+        hV_HAL_SPI_transfer(MEMORY_WRITE_ENABLE);
+        digitalWrite(m_pinCS, HIGH); // Unselect
+    }
+
+    digitalWrite(m_pinCS, LOW); // Select
+    hV_HAL_SPI_transfer(command);
+    if (m_addressBytes > 2)
+    {
+        hV_HAL_SPI_transfer((uint8_t)(address >> 16));
+    }
+    hV_HAL_SPI_transfer((uint8_t)(address >> 8));
+    hV_HAL_SPI_transfer((uint8_t)address);
+}
+
+void hV_Memory_SPI::read(uint32_t address, uint8_t * data, uint32_t size)
+{
+    m_start(MEMORY_READ, address);
+    for (uint32_t index = 0; index < size; index++)
+    {
+        data[index] = hV_HAL_SPI_transfer(0x00);
+    }
+    digitalWrite(m_pinCS, HIGH); // Unselect
+}
+
+void hV_Memory_SPI::readBegin(uint32_t address)
+{
+    m_start(MEMORY_READ, address);
+}
+
+void hV_Memory_SPI::readNext(uint8_t * data, uint32_t size)
+{
+    for (uint32_t index = 0; index < size; index++)
+    {
+        uint8_t value = hV_HAL_SPI_transfer(0x00);
+        if (data != nullptr)
+        {
+            data[index] = value;
+        }
+    }
+}
+
+void hV_Memory_SPI::readEnd()
+{
+    digitalWrite(m_pinCS, HIGH); // Unselect
+}
+
+void hV_Memory_SPI::write(uint32_t address, const uint8_t * data, uint32_t size)
+{
+    if (m_kind == EXTERNAL_SPI_FLASH)
+    {
+        return;
+    }
+
+    m_start(MEMORY_WRITE, address);
+    for (uint32_t index = 0; index < size; index++)
+    {
+        hV_HAL_SPI_transfer(data[index]);
+    }
+    digitalWrite(m_pinCS, HIGH); // Unselect
+}
+
+void hV_Memory_SPI::fill(uint32_t address, uint8_t value, uint32_t size)
+{
+    if (m_kind == EXTERNAL_SPI_FLASH)
+    {
+        return;
+    }
+
+    m_start(MEMORY_WRITE, address);
+    for (uint32_t index = 0; index < size; index++)
+    {
+        hV_HAL_SPI_transfer(value);
+    }
+    digitalWrite(m_pinCS, HIGH); // Unselect
+}
+
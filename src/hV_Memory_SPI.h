@@ -0,0 +1,145 @@
+///
+/// @file hV_Memory_SPI.h
+/// @brief Driver for external SPI SRAM, FRAM and Flash memory
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Supported memories
+/// * 23LC1024-like SPI SRAM, sequential mode
+/// * MB85RS-like SPI FRAM
+/// * W25Q-like SPI Flash, read only
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+#ifndef hV_MEMORY_SPI_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_MEMORY_SPI_RELEASE 830
+
+// Objects
+//
+///
+/// @brief Class for external SPI memory
+/// @details Byte-addressable memory on the shared SPI bus
+/// * SPI SRAM, set to sequential mode at begin()
+/// * SPI FRAM, write enable before each write
+/// * SPI Flash, released from deep power-down at begin(), read only
+///
+/// @note The SPI bus is configured and started by the screen
+/// @warning Each transaction selects and releases the memory,
+/// so the screen /CS should be high before calling any function
+///
+class hV_Memory_SPI
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_Memory_SPI();
+
+    ///
+    /// @brief Initialisation
+    /// @param pinCS memory /CS pin
+    /// @param kind EXTERNAL_SPI_SRAM, EXTERNAL_SPI_FRAM or EXTERNAL_SPI_FLASH
+    /// @param addressBytes number of address bytes, 2 or 3
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    ///
+    bool begin(uint8_t pinCS, uint8_t kind, uint8_t addressBytes = 3);
+
+    ///
+    /// @brief Read a block
+    /// @param address start address
+    /// @param data buffer, modified
+    /// @param size number of bytes
+    ///
+    void read(uint32_t address, uint8_t * data, uint32_t size);
+
+    ///
+    /// @brief Start a sequential read
+    /// @param address start address
+    /// @note Keeps the memory selected until readEnd()
+    ///
+    void readBegin(uint32_t address);
+
+    ///
+    /// @brief Continue a sequential read
+    /// @param data buffer, modified, nullptr to skip the bytes
+    /// @param size number of bytes
+    ///
+    void readNext(uint8_t * data, uint32_t size);
+
+    ///
+    /// @brief End a sequential read
+    ///
+    void readEnd();
+
+    ///
+    /// @brief Write a block
+    /// @param address start address
+    /// @param data buffer
+    /// @param size number of bytes
+    /// @note Not available for SPI Flash
+    ///
+    void write(uint32_t address, const uint8_t * data, uint32_t size);
+
+    ///
+    /// @brief Fill a block with a value
+    /// @param address start address
+    /// @param value byte value
+    /// @param size number of bytes
+    /// @note Not available for SPI Flash
+    ///
+    void fill(uint32_t address, uint8_t value, uint32_t size);
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Start a transaction
+    /// @param command memory command
+    /// @param address start address
+    ///
+    void m_start(uint8_t command, uint32_t address);
+
+    uint8_t m_pinCS;
+    uint8_t m_kind;
+    uint8_t m_addressBytes;
+
+    /// @endcond
+};
+
+#endif // hV_MEMORY_SPI_RELEASE
+
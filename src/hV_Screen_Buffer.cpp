@@ -21,12 +21,60 @@
 // Release 703: Improved orientation function
 // Release 801: Improved functions names consistency
 // Release 805: Added large variant for gText()
+// Release 830: Added heap-free text functions
+// Release 830: Added fixed-point numbers
+// Release 830: Added UTF-8 decoding
+// Release 830: Added proportional fonts
+// Release 830: Added fonts on external SPI Flash
+// Release 830: Added scroll
+// Release 830: Added scroll left
+// Release 830: Added display list
+// Release 830: Added read pixel and flood fill
+// Release 830: Added area fill for lines and solid shapes
 //
 
 // Library header
 #include "hV_Screen_Buffer.h"
+#include "stdarg.h"
+#include "stdio.h"
 //#include "QuickDebug.h"
 
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+// Areas overlap
+static bool listOverlap(const area_s & a, const area_s & b)
+{
+    return (a.dx > 0) and (a.dy > 0) and (b.dx > 0) and (b.dy > 0)
+           and (a.x0 < b.x0 + b.dx) and (b.x0 < a.x0 + a.dx)
+           and (a.y0 < b.y0 + b.dy) and (b.y0 < a.y0 + a.dy);
+}
+
+// Area a inside area b
+static bool listInside(const area_s & a, const area_s & b)
+{
+    return (a.x0 >= b.x0) and (a.y0 >= b.y0)
+           and (a.x0 + a.dx <= b.x0 + b.dx) and (a.y0 + a.dy <= b.y0 + b.dy);
+}
+
+// Same commands, including texts
+static bool listEqual(const displayCommand_s & a, const char * textA, const displayCommand_s & b, const char * textB)
+{
+    if ((a.kind != b.kind) or (a.flags != b.flags) or (a.colour != b.colour))
+    {
+        return false;
+    }
+    if (memcmp(a.value, b.value, sizeof(a.value)) != 0)
+    {
+        return false;
+    }
+    if (a.kind == DISPLAY_TEXT)
+    {
+        return (a.font == b.font) and (a.spaceX == b.spaceX) and (a.backColour == b.backColour)
+               and (a.length == b.length) and (memcmp(textA + a.start, textB + b.start, a.length) == 0);
+    }
+    return true;
+}
+#endif // DISPLAY_LIST
+
 // Code
 hV_Screen_Buffer::hV_Screen_Buffer()
 {
@@ -35,6 +83,19 @@ hV_Screen_Buffer::hV_Screen_Buffer()
     f_fontSolid = true;
     f_fontSpaceX = 1;
     v_penSolid = false;
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    s_listNumber = 0;
+    s_listPreviousNumber = 0;
+    s_listTextLength = 0;
+    s_listFlagRecord = false;
+    s_listFlagOverflow = false;
+    s_listFlagPrevious = false;
+    s_listFlagClip = false;
+    s_listOrientation = 0;
+    s_listClip = { 0, 0, 0, 0 };
+    resetDisplayListStatistics();
+#endif // DISPLAY_LIST
 }
 
 void hV_Screen_Buffer::begin()
@@ -44,6 +105,17 @@ void hV_Screen_Buffer::begin()
 
 void hV_Screen_Buffer::clear(uint16_t colour)
 {
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        displayCommand_s command = { DISPLAY_CLEAR, 0, 0, 0, { 0 }, colour, 0, 0, 0 };
+        if (s_recordCommand(command) == RESULT_SUCCESS)
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
     uint8_t oldOrientation = v_orientation;
     bool oldPenSolid = v_penSolid;
     setOrientation(0);
@@ -149,6 +221,17 @@ uint8_t hV_Screen_Buffer::screenColourBits()
 
 void hV_Screen_Buffer::circle(uint16_t x0, uint16_t y0, uint16_t radius, uint16_t colour)
 {
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        displayCommand_s command = { DISPLAY_CIRCLE, (uint8_t)v_penSolid, 0, 0, { x0, y0, radius }, colour, 0, 0, 0 };
+        if (s_recordCommand(command) == RESULT_SUCCESS)
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
     int16_t f = 1 - radius;
     int16_t ddF_x = 1;
     int16_t ddF_y = -2 * radius;
@@ -218,6 +301,27 @@ void hV_Screen_Buffer::dLine(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy,
 
 void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
 {
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        // Horizontal and vertical lines as fills, for merging
+        displayCommand_s command = { DISPLAY_LINE, 0, 0, 0, { x1, y1, x2, y2 }, colour, 0, 0, 0 };
+        if ((x1 == x2) or (y1 == y2))
+        {
+            command.kind = DISPLAY_FILL;
+            command.flags = 1;
+            command.value[0] = hV_HAL_min(x1, x2);
+            command.value[1] = hV_HAL_min(y1, y2);
+            command.value[2] = hV_HAL_max(x1, x2) - command.value[0] + 1;
+            command.value[3] = hV_HAL_max(y1, y2) - command.value[1] + 1;
+        }
+        if (s_recordCommand(command) == RESULT_SUCCESS)
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
     if ((x1 == x2) and (y1 == y2))
     {
         s_setPoint(x1, y1, colour);
@@ -228,10 +332,7 @@ void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
         {
             hV_HAL_swap(y1, y2);
         }
-        for (uint16_t y = y1; y <= y2; y++)
-        {
-            s_setPoint(x1, y, colour);
-        }
+        s_setArea(x1, y1, x2, y2, colour);
     }
     else if (y1 == y2)
     {
@@ -239,10 +340,7 @@ void hV_Screen_Buffer::line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
         {
             hV_HAL_swap(x1, x2);
         }
-        for (uint16_t x = x1; x <= x2; x++)
-        {
-            s_setPoint(x, y1, colour);
-        }
+        s_setArea(x1, y1, x2, y2, colour);
     }
     else
     {
@@ -304,13 +402,48 @@ void hV_Screen_Buffer::setPenSolid(bool flag)
     v_penSolid = flag;
 }
 
+bool hV_Screen_Buffer::getPenSolid()
+{
+    return v_penSolid;
+}
+
 void hV_Screen_Buffer::point(uint16_t x1, uint16_t y1, uint16_t colour)
 {
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        // Point as fill, for merging
+        displayCommand_s command = { DISPLAY_FILL, 1, 0, 0, { x1, y1, 1, 1 }, colour, 0, 0, 0 };
+        if (s_recordCommand(command) == RESULT_SUCCESS)
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
     s_setPoint(x1, y1, colour);
 }
 
 void hV_Screen_Buffer::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
 {
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        uint16_t x0 = hV_HAL_min(x1, x2);
+        uint16_t y0 = hV_HAL_min(y1, y2);
+        displayCommand_s command = { DISPLAY_FRAME, 0, 0, 0, { x0, y0, (uint16_t)(hV_HAL_max(x1, x2) - x0 + 1), (uint16_t)(hV_HAL_max(y1, y2) - y0 + 1) }, colour, 0, 0, 0 };
+        if (v_penSolid)
+        {
+            command.kind = DISPLAY_FILL;
+            command.flags = 1;
+        }
+        if (s_recordCommand(command) == RESULT_SUCCESS)
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
     if (v_penSolid == false)
     {
         line(x1, y1, x1, y2, colour);
@@ -328,13 +461,7 @@ void hV_Screen_Buffer::rectangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
         {
             hV_HAL_swap(y1, y2);
         }
-        for (uint16_t x = x1; x <= x2; x++)
-        {
-            for (uint16_t y = y1; y <= y2; y++)
-            {
-                s_setPoint(x, y, colour);
-            }
-        }
+        s_setArea(x1, y1, x2, y2, colour);
     }
 }
 
@@ -343,6 +470,45 @@ void hV_Screen_Buffer::dRectangle(uint16_t x0, uint16_t y0, uint16_t dx, uint16_
     rectangle(x0, y0, x0 + dx - 1, y0 + dy - 1, colour);
 }
 
+bool hV_Screen_Buffer::scroll(uint16_t y0, uint16_t dy, uint16_t number, uint16_t colour)
+{
+    // Requires access to the frame-buffer
+    return RESULT_ERROR;
+}
+
+bool hV_Screen_Buffer::scrollLeft(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t number, uint16_t colour)
+{
+    // Requires access to the frame-buffer
+    return RESULT_ERROR;
+}
+
+uint16_t hV_Screen_Buffer::readPixel(uint16_t x1, uint16_t y1)
+{
+    // Requires access to the frame-buffer
+    return myColours.white;
+}
+
+bool hV_Screen_Buffer::floodFill(uint16_t x0, uint16_t y0, uint16_t colour)
+{
+    // Requires access to the frame-buffer
+    return RESULT_ERROR;
+}
+
+void hV_Screen_Buffer::s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour)
+{
+    // Clip to the screen, also avoids endless loop with x2 or y2 = 0xffff
+    x2 = hV_HAL_min(x2, (uint16_t)(screenSizeX() - 1));
+    y2 = hV_HAL_min(y2, (uint16_t)(screenSizeY() - 1));
+
+    for (uint16_t x = x1; x <= x2; x++)
+    {
+        for (uint16_t y = y1; y <= y2; y++)
+        {
+            s_setPoint(x, y, colour);
+        }
+    }
+}
+
 void hV_Screen_Buffer::s_triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
 {
     int16_t wx1 = (int16_t)x1;
@@ -445,6 +611,17 @@ void hV_Screen_Buffer::s_triangleArea(uint16_t x1, uint16_t y1, uint16_t x2, uin
 
 void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t x3, uint16_t y3, uint16_t colour)
 {
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        displayCommand_s command = { DISPLAY_TRIANGLE, (uint8_t)v_penSolid, 0, 0, { x1, y1, x2, y2, x3, y3 }, colour, 0, 0, 0 };
+        if (s_recordCommand(command) == RESULT_SUCCESS)
+        {
+            return;
+        }
+    }
+#endif // DISPLAY_LIST
+
     if ((x1 == x2) and (y1 == y2))
     {
         line(x3, y3, x1, y1, colour);
@@ -519,6 +696,389 @@ void hV_Screen_Buffer::triangle(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t
     }
 }
 
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+//
+// === Display list section
+//
+void hV_Screen_Buffer::setDisplayList(bool flag)
+{
+    if (flag)
+    {
+        if ((s_listFlagRecord == false) and (s_listFlagOverflow == false))
+        {
+            // Frame-buffer content unknown, first list rasterised whole
+            s_listNumber = 0;
+            s_listTextLength = 0;
+            s_listFlagPrevious = false;
+            s_listFlagRecord = true;
+        }
+    }
+    else
+    {
+        // Commands pending
+        renderDisplayList();
+        s_listFlagRecord = false;
+        s_listFlagPrevious = false;
+    }
+}
+
+displayListStatistics_s hV_Screen_Buffer::getDisplayListStatistics()
+{
+    return s_listStatistics;
+}
+
+void hV_Screen_Buffer::resetDisplayListStatistics()
+{
+    memset(&s_listStatistics, 0x00, sizeof(s_listStatistics));
+}
+
+bool hV_Screen_Buffer::s_recordCommand(displayCommand_s & command, const char * text)
+{
+    displayCommand_s * last = (s_listNumber > 0) ? &s_listCommand[s_listNumber - 1] : nullptr;
+
+    if (text != nullptr)
+    {
+        // Text next to the previous one with same attributes, eg. gNumber(), merged
+        if ((last != nullptr) and (last->kind == DISPLAY_TEXT)
+                and (last->start + last->length == s_listTextLength)
+                and (s_listTextLength + command.length <= DISPLAY_LIST_TEXT)
+                and (last->flags == command.flags) and (last->font == command.font) and (last->spaceX == command.spaceX)
+                and (last->colour == command.colour) and (last->backColour == command.backColour)
+                and (last->value[0] + last->value[2] == command.value[0])
+                and (last->value[1] == command.value[1]) and (last->value[3] == command.value[3]))
+        {
+            memcpy(s_listText + s_listTextLength, text, command.length);
+            s_listTextLength += command.length;
+            last->length += command.length;
+            last->value[2] += command.value[2];
+            s_listStatistics.merged += 1;
+            return RESULT_SUCCESS;
+        }
+    }
+    else if ((command.kind == DISPLAY_FILL) and (last != nullptr) and (last->kind == DISPLAY_FILL) and (last->colour == command.colour))
+    {
+        // Fill next to the previous one, eg. points of a span, merged
+        if ((last->value[1] == command.value[1]) and (last->value[3] == command.value[3])
+                and (last->value[0] + last->value[2] == command.value[0]))
+        {
+            last->value[2] += command.value[2];
+            s_listStatistics.merged += 1;
+            return RESULT_SUCCESS;
+        }
+        if ((last->value[0] == command.value[0]) and (last->value[2] == command.value[2])
+                and (last->value[1] + last->value[3] == command.value[1]))
+        {
+            last->value[3] += command.value[3];
+            s_listStatistics.merged += 1;
+            return RESULT_SUCCESS;
+        }
+    }
+
+    if ((s_listNumber >= DISPLAY_LIST_SIZE) or ((text != nullptr) and (s_listTextLength + command.length > DISPLAY_LIST_TEXT)))
+    {
+        // List full, rasterised now and next commands drawn immediately
+        renderDisplayList();
+        s_listFlagRecord = false;
+        s_listFlagOverflow = true;
+        s_listStatistics.overflows += 1;
+        return RESULT_ERROR;
+    }
+
+    if (text != nullptr)
+    {
+        command.start = s_listTextLength;
+        memcpy(s_listText + s_listTextLength, text, command.length);
+        s_listTextLength += command.length;
+    }
+
+    s_listCommand[s_listNumber] = command;
+    s_listNumber += 1;
+    s_listStatistics.recorded += 1;
+    return RESULT_SUCCESS;
+}
+
+area_s hV_Screen_Buffer::s_getCommandArea(const displayCommand_s & command)
+{
+    area_s result = { 0, 0, 0, 0 };
+    int32_t x1, y1, x2, y2; // included
+
+    switch (command.kind)
+    {
+        case DISPLAY_CLEAR:
+
+            result = { 0, 0, screenSizeX(), screenSizeY() };
+            return result;
+
+        case DISPLAY_LINE:
+
+            x1 = hV_HAL_min(command.value[0], command.value[2]);
+            y1 = hV_HAL_min(command.value[1], command.value[3]);
+            x2 = hV_HAL_max(command.value[0], command.value[2]);
+            y2 = hV_HAL_max(command.value[1], command.value[3]);
+            break;
+
+        case DISPLAY_CIRCLE:
+
+            x1 = (int32_t)command.value[0] - command.value[2];
+            y1 = (int32_t)command.value[1] - command.value[2];
+            x2 = (int32_t)command.value[0] + command.value[2];
+            y2 = (int32_t)command.value[1] + command.value[2];
+            break;
+
+        case DISPLAY_TRIANGLE:
+
+            x1 = hV_HAL_min(command.value[0], hV_HAL_min(command.value[2], command.value[4]));
+            y1 = hV_HAL_min(command.value[1], hV_HAL_min(command.value[3], command.value[5]));
+            x2 = hV_HAL_max(command.value[0], hV_HAL_max(command.value[2], command.value[4]));
+            y2 = hV_HAL_max(command.value[1], hV_HAL_max(command.value[3], command.value[5]));
+            break;
+
+        case DISPLAY_FILL:
+        case DISPLAY_FRAME:
+        case DISPLAY_TEXT:
+
+            if ((command.value[2] == 0) or (command.value[3] == 0))
+            {
+                return result;
+            }
+            x1 = command.value[0];
+            y1 = command.value[1];
+            x2 = (int32_t)command.value[0] + command.value[2] - 1;
+            y2 = (int32_t)command.value[1] + command.value[3] - 1;
+            break;
+
+        default:
+
+            return result;
+    }
+
+    // Within screen
+    x1 = hV_HAL_max(x1, (int32_t)0);
+    y1 = hV_HAL_max(y1, (int32_t)0);
+    x2 = hV_HAL_min(x2, (int32_t)screenSizeX() - 1);
+    y2 = hV_HAL_min(y2, (int32_t)screenSizeY() - 1);
+
+    if ((x2 >= x1) and (y2 >= y1))
+    {
+        result = { (uint16_t)x1, (uint16_t)y1, (uint16_t)(x2 - x1 + 1), (uint16_t)(y2 - y1 + 1) };
+    }
+    return result;
+}
+
+void hV_Screen_Buffer::s_drawCommand(const displayCommand_s & command, const char * text)
+{
+    switch (command.kind)
+    {
+        case DISPLAY_CLEAR:
+
+            if (s_listFlagClip)
+            {
+                setPenSolid(true);
+                dRectangle(s_listClip.x0, s_listClip.y0, s_listClip.dx, s_listClip.dy, command.colour);
+            }
+            else
+            {
+                clear(command.colour);
+            }
+            break;
+
+        case DISPLAY_FILL:
+        case DISPLAY_FRAME:
+
+            setPenSolid(command.kind == DISPLAY_FILL);
+            dRectangle(command.value[0], command.value[1], command.value[2], command.value[3], command.colour);
+            break;
+
+        case DISPLAY_LINE:
+
+            line(command.value[0], command.value[1], command.value[2], command.value[3], command.colour);
+            break;
+
+        case DISPLAY_CIRCLE:
+
+            setPenSolid(command.flags & 0x01);
+            circle(command.value[0], command.value[1], command.value[2], command.colour);
+            break;
+
+        case DISPLAY_TRIANGLE:
+
+            setPenSolid(command.flags & 0x01);
+            triangle(command.value[0], command.value[1], command.value[2], command.value[3], command.value[4], command.value[5], command.colour);
+            break;
+
+        case DISPLAY_TEXT:
+
+            if (command.font != f_fontSize)
+            {
+                f_selectFont(command.font);
+            }
+            f_fontSpaceX = command.spaceX;
+            f_fontSolid = (command.flags & 0x02);
+            s_drawText(command.value[0], command.value[1], text + command.start, command.length, command.colour, command.backColour, command.flags >> 4);
+            break;
+
+        default:
+
+            break;
+    }
+}
+
+area_s hV_Screen_Buffer::renderDisplayList()
+{
+    area_s result = { 0, 0, 0, 0 };
+
+    if (s_listFlagOverflow)
+    {
+        // Commands drawn immediately since the list was full, previous list no longer valid
+        s_listFlagOverflow = false;
+        s_listFlagRecord = true;
+        s_listFlagPrevious = false;
+        s_listNumber = 0;
+        s_listTextLength = 0;
+        result = { 0, 0, screenSizeX(), screenSizeY() };
+        s_listStatistics.area = result;
+        return result;
+    }
+
+    if (s_listFlagRecord == false)
+    {
+        return result;
+    }
+
+    // Empty list, previous list again
+    if ((s_listNumber == 0) and s_listFlagPrevious)
+    {
+        memcpy(s_listCommand, s_listPrevious, s_listPreviousNumber * sizeof(displayCommand_s));
+        memcpy(s_listText, s_listPreviousText, DISPLAY_LIST_TEXT);
+        s_listNumber = s_listPreviousNumber;
+    }
+
+    // Commands covered by a later fill, dropped
+    for (uint16_t i = 1; i < s_listNumber; i += 1)
+    {
+        if ((s_listCommand[i].kind == DISPLAY_CLEAR) or (s_listCommand[i].kind == DISPLAY_FILL))
+        {
+            area_s cover = s_getCommandArea(s_listCommand[i]);
+            for (uint16_t j = 0; j < i; j += 1)
+            {
+                if ((s_listCommand[j].kind != DISPLAY_NONE) and listInside(s_getCommandArea(s_listCommand[j]), cover))
+                {
+                    s_listCommand[j].kind = DISPLAY_NONE;
+                    s_listStatistics.dropped += 1;
+                }
+            }
+        }
+    }
+
+    uint16_t number = 0;
+    for (uint16_t i = 0; i < s_listNumber; i += 1)
+    {
+        if (s_listCommand[i].kind != DISPLAY_NONE)
+        {
+            s_listCommand[number] = s_listCommand[i];
+            number += 1;
+        }
+    }
+    s_listNumber = number;
+
+    // Area changed, against the previous list
+    if ((s_listFlagPrevious == false) or (s_listOrientation != v_orientation))
+    {
+        result = { 0, 0, screenSizeX(), screenSizeY() };
+    }
+    else
+    {
+        // Same commands in same order kept, others changed
+        bool flagMatched[DISPLAY_LIST_SIZE] = { false };
+        uint16_t next = 0;
+        for (uint16_t i = 0; i < s_listNumber; i += 1)
+        {
+            bool flagFound = false;
+            for (uint16_t j = next; j < s_listPreviousNumber; j += 1)
+            {
+                if (listEqual(s_listCommand[i], s_listText, s_listPrevious[j], s_listPreviousText))
+                {
+                    flagMatched[j] = true;
+                    flagFound = true;
+                    next = j + 1;
+                    break;
+                }
+            }
+            if (flagFound == false)
+            {
+                addArea(result, s_getCommandArea(s_listCommand[i]));
+            }
+        }
+        for (uint16_t j = 0; j < s_listPreviousNumber; j += 1)
+        {
+            if (flagMatched[j] == false)
+            {
+                addArea(result, s_getCommandArea(s_listPrevious[j]));
+            }
+        }
+    }
+
+    // Rasterisation of the area changed, in one pass
+    if ((result.dx > 0) and (result.dy > 0))
+    {
+        bool oldPenSolid = v_penSolid;
+        uint8_t oldFont = f_fontSize;
+        uint8_t oldFontSpaceX = f_fontSpaceX;
+        bool oldFontSolid = f_fontSolid;
+
+        s_listFlagRecord = false;
+        s_listFlagClip = (result.dx < screenSizeX()) or (result.dy < screenSizeY());
+        s_listClip = result;
+
+        // White background, unless the list starts with clear()
+        if ((s_listNumber == 0) or (s_listCommand[0].kind != DISPLAY_CLEAR))
+        {
+            displayCommand_s background = { DISPLAY_CLEAR, 0, 0, 0, { 0 }, myColours.white, 0, 0, 0 };
+            s_drawCommand(background, nullptr);
+        }
+
+        for (uint16_t i = 0; i < s_listNumber; i += 1)
+        {
+            if (listOverlap(s_getCommandArea(s_listCommand[i]), result))
+            {
+                s_drawCommand(s_listCommand[i], s_listText);
+                s_listStatistics.drawn += 1;
+            }
+            else
+            {
+                s_listStatistics.skipped += 1;
+            }
+        }
+
+        s_listFlagClip = false;
+        s_listFlagRecord = true;
+
+        if (oldFont != f_fontSize)
+        {
+            f_selectFont(oldFont);
+        }
+        f_fontSpaceX = oldFontSpaceX;
+        f_fontSolid = oldFontSolid;
+        v_penSolid = oldPenSolid;
+    }
+
+    // Current list becomes previous list
+    memcpy(s_listPrevious, s_listCommand, s_listNumber * sizeof(displayCommand_s));
+    memcpy(s_listPreviousText, s_listText, DISPLAY_LIST_TEXT);
+    s_listPreviousNumber = s_listNumber;
+    s_listFlagPrevious = true;
+    s_listOrientation = v_orientation;
+    s_listNumber = 0;
+    s_listTextLength = 0;
+
+    s_listStatistics.area = result;
+    return result;
+}
+//
+// === End of Display list section
+//
+#endif // DISPLAY_LIST
+
 //
 // === Font section
 //
@@ -527,11 +1087,33 @@ void hV_Screen_Buffer::setFontSolid(bool flag)
     f_setFontSolid(flag);
 }
 
+bool hV_Screen_Buffer::getFontSolid()
+{
+    return f_fontSolid;
+}
+
 uint8_t hV_Screen_Buffer::addFont(font_s fontName)
 {
     return f_addFont(fontName);
 }
 
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+uint8_t hV_Screen_Buffer::addFontFlash(uint32_t address)
+{
+    return f_addFontFlash(address);
+}
+
+fontCacheStatistics_s hV_Screen_Buffer::getFontCacheStatistics()
+{
+    return f_cacheStatistics;
+}
+
+void hV_Screen_Buffer::resetFontCacheStatistics()
+{
+    memset(&f_cacheStatistics, 0x00, sizeof(f_cacheStatistics));
+}
+#endif // FONT_FLASH
+
 void hV_Screen_Buffer::selectFont(uint8_t font)
 {
     f_selectFont(font);
@@ -549,17 +1131,8 @@ uint8_t hV_Screen_Buffer::fontMax()
 
 uint16_t hV_Screen_Buffer::characterSizeX(uint8_t character)
 {
-    uint16_t result = 0;
-    if ((f_font.kind & 0x40) == 0x40) // Monospaced font
-    {
-        result = f_font.maxWidth + f_fontSpaceX;
-    }
-    else
-    {
-        result = f_characterSizeX(character);
-    }
-
-    return result;
+    // Same advance as gText() and stringSizeX()
+    return f_characterSizeX(character);
 }
 
 uint16_t hV_Screen_Buffer::characterSizeY()
@@ -567,14 +1140,34 @@ uint16_t hV_Screen_Buffer::characterSizeY()
     return f_characterSizeY();
 }
 
-uint16_t hV_Screen_Buffer::stringSizeX(String text)
+uint16_t hV_Screen_Buffer::stringSizeX(const String & text)
+{
+    return f_stringSizeX(text.c_str(), text.length());
+}
+
+uint16_t hV_Screen_Buffer::stringSizeX(const char * text)
 {
-    return f_stringSizeX(text);
+    return f_stringSizeX(text, strlen(text));
 }
 
-uint8_t hV_Screen_Buffer::stringLengthToFitX(String text, uint16_t pixels)
+uint16_t hV_Screen_Buffer::stringSizeX(const char * text, uint16_t length)
 {
-    return f_stringLengthToFitX(text, pixels);
+    return f_stringSizeX(text, length);
+}
+
+uint8_t hV_Screen_Buffer::stringLengthToFitX(const String & text, uint16_t pixels)
+{
+    return f_stringLengthToFitX(text.c_str(), text.length(), pixels);
+}
+
+uint8_t hV_Screen_Buffer::stringLengthToFitX(const char * text, uint16_t pixels)
+{
+    return f_stringLengthToFitX(text, strlen(text), pixels);
+}
+
+uint8_t hV_Screen_Buffer::stringLengthToFitX(const char * text, uint16_t length, uint16_t pixels)
+{
+    return f_stringLengthToFitX(text, length, pixels);
 }
 
 void hV_Screen_Buffer::setFontSpaceX(uint8_t number)
@@ -587,348 +1180,300 @@ void hV_Screen_Buffer::setFontSpaceY(uint8_t number)
     f_setFontSpaceY(number);
 }
 
+void hV_Screen_Buffer::setFontReplacement(uint8_t character)
+{
+    f_setFontReplacement(character);
+}
+
 uint8_t hV_Screen_Buffer::s_getCharacter(uint8_t character, uint8_t index)
 {
     return f_getCharacter(character, index);
 }
 
 void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
-                             String text,
+                             const String & text,
                              uint16_t textColour,
                              uint16_t backColour)
 {
-#if (FONT_MODE == USE_FONT_TERMINAL)
+    s_drawText(x0, y0, text.c_str(), text.length(), textColour, backColour, 1);
+}
 
-    uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
+void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
+                             const char * text,
+                             uint16_t textColour,
+                             uint16_t backColour)
+{
+    s_drawText(x0, y0, text, strlen(text), textColour, backColour, 1);
+}
 
-#if (MAX_FONT_SIZE > 0)
+void hV_Screen_Buffer::gText(uint16_t x0, uint16_t y0,
+                             const char * text, uint16_t length,
+                             uint16_t textColour, uint16_t backColour)
+{
+    s_drawText(x0, y0, text, length, textColour, backColour, 1);
+}
 
-    if (f_fontSize == 0)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
+void hV_Screen_Buffer::gTextf(uint16_t x0, uint16_t y0, const char * format, ...)
+{
+    char work[TEXT_FORMAT_SIZE];
 
-            for (i = 0; i < 6; i++)
-            {
-                line = f_getCharacter(c, i);
+    va_list args;
+    va_start(args, format);
+    int16_t length = vsnprintf(work, sizeof(work), format, args);
+    va_end(args);
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 6 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 6 * k + i, y0 + j, backColour);
-                    }
-                }
-            }
-        }
+    if (length < 0)
+    {
+        return;
     }
-
-#if (MAX_FONT_SIZE > 1)
-
-    else if (f_fontSize == 1)
+    if (length > (int16_t)(sizeof(work) - 1))
     {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
-
-            for (i = 0; i < 8; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
-
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 8 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if ((f_fontSolid) and (j < 4))
-                    {
-                        point(x0 + 8 * k + i, y0 + 8 + j, backColour);
-                    }
-                }
-            }
-        }
+        length = sizeof(work) - 1; // truncated
     }
 
-#if (MAX_FONT_SIZE > 2)
+    s_drawText(x0, y0, work, length, myColours.black, myColours.white, 1);
+}
 
-    else if (f_fontSize == 2)
-    {
+void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
+                                  const String & text,
+                                  uint16_t textColour,
+                                  uint16_t backColour)
+{
+    s_drawText(x0, y0, text.c_str(), text.length(), textColour, backColour, 2);
+}
 
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
+void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
+                                  const char * text,
+                                  uint16_t textColour,
+                                  uint16_t backColour)
+{
+    s_drawText(x0, y0, text, strlen(text), textColour, backColour, 2);
+}
 
-            for (i = 0; i < 12; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
+void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
+                                  const char * text, uint16_t length,
+                                  uint16_t textColour, uint16_t backColour)
+{
+    s_drawText(x0, y0, text, length, textColour, backColour, 2);
+}
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 12 * k + i, y0 + 8 + j, backColour);
-                    }
-                }
-            }
-        }
-    }
-#if (MAX_FONT_SIZE > 3)
+void hV_Screen_Buffer::gNumber(uint16_t x0, uint16_t y0,
+                               int32_t value, uint8_t decimals,
+                               uint8_t width, uint8_t align,
+                               const char * unit,
+                               uint16_t textColour, uint16_t backColour)
+{
+    s_drawNumber(x0, y0, value, decimals, width, align, unit, textColour, backColour, 1);
+}
 
-    else if (f_fontSize == 3)
-    {
-        for (k = 0; k < text.length(); k++)
-        {
-            c = text.charAt(k) - ' ';
-            for (i = 0; i < 16; i++)
-            {
-                line = f_getCharacter(c, 3 * i);
-                line1 = f_getCharacter(c, 3 * i + 1);
-                line2 = f_getCharacter(c, 3 * i + 2);
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + j, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 8 + j, backColour);
-                    }
-                    if (bitRead(line2, j))
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        point(x0 + 16 * k + i, y0 + 16 + j, backColour);
-                    }
-                }
-            }
-        }
-    }
-#endif // end MAX_FONT_SIZE > 3
-#endif // end MAX_FONT_SIZE > 2
-#endif // end MAX_FONT_SIZE > 1
-#endif // end MAX_FONT_SIZE > 0
-#endif // FONT_MODE
+void hV_Screen_Buffer::gNumberLarge(uint16_t x0, uint16_t y0,
+                                    int32_t value, uint8_t decimals,
+                                    uint8_t width, uint8_t align,
+                                    const char * unit,
+                                    uint16_t textColour, uint16_t backColour)
+{
+    s_drawNumber(x0, y0, value, decimals, width, align, unit, textColour, backColour, 2);
 }
 
-void hV_Screen_Buffer::gTextLarge(uint16_t x0, uint16_t y0,
-                                  String text,
-                                  uint16_t textColour,
-                                  uint16_t backColour)
+void hV_Screen_Buffer::s_drawNumber(uint16_t x0, uint16_t y0,
+                                    int32_t value, uint8_t decimals,
+                                    uint8_t width, uint8_t align,
+                                    const char * unit,
+                                    uint16_t textColour, uint16_t backColour,
+                                    uint8_t scale)
 {
-#if (FONT_MODE == USE_FONT_TERMINAL)
+    // Up to 10 digits for a 32-bit value
+    const uint32_t powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
 
-    uint8_t c;
-    uint8_t line, line1, line2, line3;
-    uint16_t x, y;
-    uint8_t i, j, k;
+    bool flagNegative = (value < 0);
+    uint32_t magnitude = flagNegative ? (uint32_t)(-(value + 1)) + 1 : (uint32_t)value;
 
-    uint8_t ix = 2;
-    uint8_t iy = 2;
+    if (decimals > 9)
+    {
+        decimals = 9;
+    }
 
-    bool oldPenSolid = v_penSolid;
-    setPenSolid(true);
+    // Number of digits, at least one for the integer part
+    uint8_t digits = 1;
+    while ((digits < 10) and (magnitude >= powers[digits]))
+    {
+        digits += 1;
+    }
+    if (digits < decimals + 1)
+    {
+        digits = decimals + 1;
+    }
 
-#if (MAX_FONT_SIZE > 0)
+    uint8_t unitLength = (unit != nullptr) ? strlen(unit) : 0;
+    uint8_t unitGlyphs = f_countGlyphs(unit, unitLength); // UTF-8
+    uint8_t count = flagNegative + digits + ((decimals > 0) ? 1 : 0) + unitGlyphs;
 
-    if (f_fontSize == 0)
+    // Padding
+    uint8_t padBefore = 0;
+    uint8_t padAfter = 0;
+    if (width > count)
     {
-        for (k = 0; k < text.length(); k++)
+        switch (align)
         {
-            x = x0 + 6 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
+            case ALIGN_LEFT:
 
-            for (i = 0; i < 6; i++)
-            {
-                line = f_getCharacter(c, i);
+                padAfter = width - count;
+                break;
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y + j * iy, ix, iy, backColour);
-                    }
-                }
-            }
+            case ALIGN_CENTER:
+
+                padBefore = (width - count) / 2;
+                padAfter = width - count - padBefore;
+                break;
+
+            default: // ALIGN_RIGHT
+
+                padBefore = width - count;
+                break;
         }
     }
 
-#if (MAX_FONT_SIZE > 1)
+    uint16_t x = x0;
+    char c;
 
-    else if (f_fontSize == 1)
+    c = ' ';
+    for (uint8_t index = 0; index < padBefore; index += 1)
     {
-        for (k = 0; k < text.length(); k++)
-        {
-            x = x0 + 8 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
+        x += s_drawText(x, y0, &c, 1, textColour, backColour, scale);
+    }
 
-            for (i = 0; i < 8; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
+    if (flagNegative)
+    {
+        c = '-';
+        x += s_drawText(x, y0, &c, 1, textColour, backColour, scale);
+    }
 
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, textColour);
-                    }
-                    else if ((f_fontSolid) and (j < 4))
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, backColour);
-                    }
-                }
-            }
+    for (uint8_t index = digits; index > 0; index -= 1)
+    {
+        if (index == decimals)
+        {
+            c = '.';
+            x += s_drawText(x, y0, &c, 1, textColour, backColour, scale);
         }
+
+        c = '0' + (magnitude / powers[index - 1]) % 10;
+        x += s_drawText(x, y0, &c, 1, textColour, backColour, scale);
     }
 
-#if (MAX_FONT_SIZE > 2)
+    if (unitLength > 0)
+    {
+        x += s_drawText(x, y0, unit, unitLength, textColour, backColour, scale);
+    }
 
-    else if (f_fontSize == 2)
+    c = ' ';
+    for (uint8_t index = 0; index < padAfter; index += 1)
     {
+        x += s_drawText(x, y0, &c, 1, textColour, backColour, scale);
+    }
+}
 
-        for (k = 0; k < text.length(); k++)
+uint16_t hV_Screen_Buffer::s_drawText(uint16_t x0, uint16_t y0,
+                                      const char * text, uint16_t length,
+                                      uint16_t textColour, uint16_t backColour,
+                                      uint8_t scale)
+{
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    if (s_listFlagRecord)
+    {
+        uint16_t width = f_stringSizeX(text, length) * scale;
+        displayCommand_s command = { DISPLAY_TEXT, (uint8_t)((f_fontSolid ? 0x02 : 0x00) | (scale << 4)), f_fontSize, f_fontSpaceX,
+                                     { x0, y0, width, (uint16_t)(f_font.height * scale) }, textColour, backColour, 0, length
+                                   };
+        if (s_recordCommand(command, text) == RESULT_SUCCESS)
         {
-            x = x0 + 12 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
-
-            for (i = 0; i < 12; i++)
-            {
-                line = f_getCharacter(c, 2 * i);
-                line1 = f_getCharacter(c, 2 * i + 1);
-
-                for (j = 0; j < 8; j++)
-                {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line1, j))
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, backColour);
-                    }
-                }
-            }
+            return width;
         }
     }
+#endif // DISPLAY_LIST
 
-#if (MAX_FONT_SIZE > 3)
+    uint16_t x = x0;
 
-    else if (f_fontSize == 3)
+#if (FONT_MODE == USE_FONT_TERMINAL)
+
+    // Terminal fonts are column-based, with bytesPerColumn bytes per column
+    // * Terminal6x8: 1 byte, Terminal8x12: 2 bytes, 4 rows for the second one
+    // * Terminal12x16: 2 bytes, Terminal16x24: 3 bytes
+    // Proportional fonts add spaceX columns after each character
+    uint8_t bytesPerColumn = (f_font.height + 7) / 8;
+    uint8_t spaceX = (f_font.column != nullptr) ? f_fontSpaceX : 0;
+    uint16_t y;
+    uint8_t c, line, width;
+
+    bool oldPenSolid = v_penSolid;
+    if (scale > 1)
     {
-        for (k = 0; k < text.length(); k++)
+        setPenSolid(true);
+    }
+
+    uint16_t index = 0; // byte
+    while (index < length)
+    {
+        c = f_getGlyph(utf8CodePoint(text, length, index)) - ' ';
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+        // Font on SPI Flash, read ahead the rest of the string on a miss
+        if (f_fontFlash)
         {
-            x = x0 + 16 * k * ix;
-            y = y0;
-            c = text.charAt(k) - ' ';
+            f_loadGlyph(c, text, length, index);
+        }
+#endif // FONT_FLASH
+
+        width = f_getCharacterWidth(c).pixel;
 
-            for (i = 0; i < 16; i++)
+        for (uint8_t i = 0; i < width + spaceX; i += 1)
+        {
+            for (uint8_t b = 0; b < bytesPerColumn; b += 1)
             {
-                line = f_getCharacter(c, 3 * i);
-                line1 = f_getCharacter(c, 3 * i + 1);
-                line2 = f_getCharacter(c, 3 * i + 2);
-                for (j = 0; j < 8; j++)
+                line = (i < width) ? f_getCharacter(c, bytesPerColumn * i + b) : 0x00;
+
+                for (uint8_t j = 0; j < 8; j += 1)
                 {
-                    if (bitRead(line, j))
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, textColour);
-                    }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + j * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line1, j))
+                    uint8_t row = 8 * b + j;
+                    if (row >= f_font.height)
                     {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, textColour);
+                        break;
                     }
-                    else if (f_fontSolid)
-                    {
-                        dRectangle(x + i * ix, y0 + (8 + j) * iy, ix, iy, backColour);
-                    }
-                    if (bitRead(line2, j))
+
+                    y = y0 + row * scale;
+                    if (bitRead(line, j))
                     {
-                        dRectangle(x + i * ix, y0 + (16 + j) * iy, ix, iy, textColour);
+                        if (scale > 1)
+                        {
+                            dRectangle(x + i * scale, y, scale, scale, textColour);
+                        }
+                        else
+                        {
+                            point(x + i, y, textColour);
+                        }
                     }
                     else if (f_fontSolid)
                     {
-                        dRectangle(x + i * ix, y0 + (16 + j) * iy, ix, iy, backColour);
+                        if (scale > 1)
+                        {
+                            dRectangle(x + i * scale, y, scale, scale, backColour);
+                        }
+                        else
+                        {
+                            point(x + i, y, backColour);
+                        }
                     }
                 }
             }
         }
+
+        x += (width + spaceX) * scale;
     }
-#endif // end MAX_FONT_SIZE > 3
-#endif // end MAX_FONT_SIZE > 2
-#endif // end MAX_FONT_SIZE > 1
-#endif // end MAX_FONT_SIZE > 0
 
     setPenSolid(oldPenSolid);
 
 #endif // FONT_MODE
+
+    return x - x0;
 }
 //
 // === End of Font section
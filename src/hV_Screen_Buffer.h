@@ -57,6 +57,52 @@
 #error FONT_MODE not defined
 #endif // FONT_MODE
 
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+///
+/// @name Kinds of commands of the display list
+/// @{
+#define DISPLAY_NONE 0 ///< dropped
+#define DISPLAY_CLEAR 1 ///< clear()
+#define DISPLAY_FILL 2 ///< solid rectangle, point, horizontal or vertical line
+#define DISPLAY_FRAME 3 ///< rectangle outline
+#define DISPLAY_LINE 4 ///< line
+#define DISPLAY_CIRCLE 5 ///< circle
+#define DISPLAY_TRIANGLE 6 ///< triangle
+#define DISPLAY_TEXT 7 ///< text
+/// @}
+
+///
+/// @brief Command of the display list
+/// @details Primitive with its coordinates, applied with the orientation current at flush()
+///
+struct displayCommand_s
+{
+    uint8_t kind; ///< primitive, 0 = dropped
+    uint8_t flags; ///< bit 0 = pen solid, bit 1 = font solid, bits 4..7 = scale
+    uint8_t font; ///< font, for text
+    uint8_t spaceX; ///< pixels between two characters, for text
+    uint16_t value[6]; ///< coordinates, or x0, y0, width and height for text
+    uint16_t colour; ///< 16-bit colour
+    uint16_t backColour; ///< 16-bit colour, for text
+    uint16_t start; ///< first byte of the text in the list
+    uint16_t length; ///< number of bytes of the text
+};
+
+///
+/// @brief Statistics of the display list
+///
+struct displayListStatistics_s
+{
+    uint32_t recorded; ///< commands recorded
+    uint32_t merged; ///< commands merged into the previous one
+    uint32_t dropped; ///< commands dropped, covered by a later fill
+    uint32_t skipped; ///< commands not rasterised, out of the area changed
+    uint32_t drawn; ///< commands rasterised
+    uint32_t overflows; ///< lists full, rasterised before flush()
+    area_s area; ///< area changed at last rasterisation
+};
+#endif // DISPLAY_LIST
+
 ///
 /// @brief Generic buffered screen class
 /// @details This class provides the text and graphic primitives for the buffered screen
@@ -152,6 +198,43 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
 
     /// @}
 
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    /// @name Display list
+    /// @{
+
+    ///
+    /// @brief Record the primitives into the display list
+    /// @param flag true = record, false = draw immediately, default = true
+    /// @note The list describes the whole frame on a white background,
+    /// from the first primitive after the previous flush()
+    /// @note Disabling the list rasterises the commands pending
+    /// @note scroll(), scrollLeft(), rotate() and floodFill() are not available while recording
+    ///
+    void setDisplayList(bool flag = true);
+
+    ///
+    /// @brief Rasterise the display list into the frame-buffer
+    /// @return area changed, empty if the list is the same as the previous one
+    /// @note Called by flush(), required before flushMode()
+    /// @note An empty list rasterises the previous list again,
+    /// eg. after setOrientation() without drawing again
+    ///
+    area_s renderDisplayList();
+
+    ///
+    /// @brief Get the statistics of the display list
+    /// @return commands recorded, merged, dropped, skipped, drawn and last area changed
+    ///
+    displayListStatistics_s getDisplayListStatistics();
+
+    ///
+    /// @brief Reset the statistics of the display list
+    ///
+    void resetDisplayListStatistics();
+
+    /// @}
+#endif // DISPLAY_LIST
+
     /// @name Graphics
     ///
     /// @{
@@ -197,6 +280,12 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void setPenSolid(bool flag = true);
 
+    ///
+    /// @brief Get pen opaque
+    /// @return true = opaque = solid, false = wire frame
+    ///
+    virtual bool getPenSolid();
+
     ///
     /// @brief Draw triangle, rectangle coordinates
     /// @param x1 first point coordinate, x-axis
@@ -246,6 +335,61 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void point(uint16_t x1, uint16_t y1, uint16_t colour);
 
+    ///
+    /// @brief Scroll up a band of the screen
+    /// @param y0 top coordinate of the band, y-axis
+    /// @param dy height of the band, y-axis
+    /// @param number of pixels to scroll up, y-axis
+    /// @param colour 16-bit colour for the pixels freed at the bottom, default = white
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The band spans the whole width of the screen
+    /// @note The frame-buffer is shifted, nothing is drawn again.
+    /// Default implementation returns RESULT_ERROR = not available.
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual bool scroll(uint16_t y0, uint16_t dy, uint16_t number, uint16_t colour = myColours.white);
+
+    ///
+    /// @brief Scroll left an area of the screen
+    /// @param x0 top left coordinate of the area, x-axis
+    /// @param y0 top left coordinate of the area, y-axis
+    /// @param dx width of the area, x-axis
+    /// @param dy height of the area, y-axis
+    /// @param number of pixels to scroll left, x-axis
+    /// @param colour 16-bit colour for the pixels freed at the right, default = white
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The frame-buffer is shifted, nothing is drawn again.
+    /// Default implementation returns RESULT_ERROR = not available.
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual bool scrollLeft(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy, uint16_t number, uint16_t colour = myColours.white);
+
+    ///
+    /// @brief Read pixel
+    /// @param x1 point coordinate, x-axis
+    /// @param y1 point coordinate, y-axis
+    /// @return 16-bit colour, black or white
+    /// @note Default implementation returns white = not available.
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual uint16_t readPixel(uint16_t x1, uint16_t y1);
+
+    ///
+    /// @brief Fill the area around a point
+    /// @param x0 seed coordinate, x-axis
+    /// @param y0 seed coordinate, y-axis
+    /// @param colour 16-bit colour, black or white
+    /// @return RESULT_SUCCESS = false = success, RESULT_ERROR = true = error
+    /// @note The pixels connected to the seed with the same colour are filled, 4-connectivity.
+    /// Default implementation returns RESULT_ERROR = not available.
+    ///
+    /// @n @b More: @ref Coordinate, @ref Colour
+    ///
+    virtual bool floodFill(uint16_t x0, uint16_t y0, uint16_t colour);
+
     /// @}
 
     /// @name Text
@@ -267,17 +411,47 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @brief Add a font
     /// @param fontName name of the font
     /// @return number of the font, 0 otherwise
+    /// @note Proportional or sparse fonts generated by extras/bdf2pdls.py, eg. addFont(Cyrillic13p_font)
     /// @note Previously selectFont()
     /// @n @b More: @ref Fonts
     ///
     virtual uint8_t addFont(font_s fontName);
 
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+    ///
+    /// @brief Add a font stored on external SPI Flash
+    /// @param address address of the font on SPI Flash
+    /// @return number of the font for selectFont(), 0 otherwise
+    /// @note Fonts generated by extras/bdf2pdls.py with --binary
+    /// @note Glyphs are read through a LRU cache, see FONT_FLASH_CACHE_GLYPHS
+    /// @n @b More: @ref Fonts
+    ///
+    uint8_t addFontFlash(uint32_t address);
+
+    ///
+    /// @brief Get the statistics of the glyph cache for fonts on SPI Flash
+    /// @return hits, misses, SPI transactions and bytes read
+    ///
+    fontCacheStatistics_s getFontCacheStatistics();
+
+    ///
+    /// @brief Reset the statistics of the glyph cache for fonts on SPI Flash
+    ///
+    void resetFontCacheStatistics();
+#endif // FONT_FLASH
+
     ///
     /// @brief Set transparent or opaque text
     /// @param flag default = 1 = opaque = solid, false = transparent
     ///
     virtual void setFontSolid(bool flag = true);
 
+    ///
+    /// @brief Get transparent or opaque text
+    /// @return true = opaque = solid, false = transparent
+    ///
+    virtual bool getFontSolid();
+
     ///
     /// @brief Set additional spaces between two characters, horizontal axis
     /// @param number of spaces default = 1 pixel
@@ -290,13 +464,22 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void setFontSpaceY(uint8_t number = 1);
 
+    ///
+    /// @brief Set replacement character for code points not available in the fonts
+    /// @param character character 32~255, default = '?'
+    /// @n @b More: @ref Fonts
+    ///
+    void setFontReplacement(uint8_t character = '?');
+
     ///
     /// @brief Character size, x-axis
     /// @param character character to evaluate, default = 0 = font general size
     /// @return horizontal size of the font for the specified character, in pixels
-    /// @note With setSpaceX included
+    /// @note Same advance as gText() and stringSizeX():
+    /// monospaced fonts include the spacing in the glyph,
+    /// proportional fonts add setFontSpaceX()
     /// @note In variable font, each character has a specific size.
-    /// The general size is indicative.
+    /// The general size is the size of the widest character.
     /// @note Previously fontSizeX()
     /// @n @b More: @ref Fonts
     ///
@@ -316,7 +499,24 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @return horizontal size of the string for current font, in pixels
     /// @n @b More: @ref Fonts
     ///
-    virtual uint16_t stringSizeX(String text);
+    virtual uint16_t stringSizeX(const String & text);
+
+    ///
+    /// @brief String size, x-axis
+    /// @param text null-terminated string to evaluate
+    /// @return horizontal size of the string for current font, in pixels
+    /// @n @b More: @ref Fonts
+    ///
+    uint16_t stringSizeX(const char * text);
+
+    ///
+    /// @brief String size, x-axis
+    /// @param text UTF-8 string to evaluate
+    /// @param length number of bytes to consider
+    /// @return horizontal size of the characters for current font, in pixels
+    /// @n @b More: @ref Fonts
+    ///
+    uint16_t stringSizeX(const char * text, uint16_t length);
 
     ///
     /// @brief Number of characters to fit a size, x-axis
@@ -325,7 +525,27 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @return number of characters to be displayed inside the pixels
     /// @n @b More: @ref Fonts
     ///
-    virtual uint8_t stringLengthToFitX(String text, uint16_t pixels);
+    virtual uint8_t stringLengthToFitX(const String & text, uint16_t pixels);
+
+    ///
+    /// @brief Number of characters to fit a size, x-axis
+    /// @param text null-terminated string to evaluate
+    /// @param pixels number of pixels to fit in
+    /// @return number of characters to be displayed inside the pixels
+    /// @n @b More: @ref Fonts
+    ///
+    uint8_t stringLengthToFitX(const char * text, uint16_t pixels);
+
+    ///
+    /// @brief Number of characters to fit a size, x-axis
+    /// @param text UTF-8 string to evaluate
+    /// @param length number of bytes to consider
+    /// @param pixels number of pixels to fit in
+    /// @return number of bytes of the characters to be displayed inside the pixels,
+    /// ready for gText() with length
+    /// @n @b More: @ref Fonts
+    ///
+    uint8_t stringLengthToFitX(const char * text, uint16_t length, uint16_t pixels);
 
     ///
     /// @brief Number of fonts
@@ -343,14 +563,62 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @param textColour 16-bit colour, default = white
     /// @param backColour 16-bit colour, default = black
     /// @note Previously gText() with ix and iy
+    /// @note UTF-8 is decoded on the fly, ISO-8859-1 is also accepted,
+    /// see setFontReplacement() for characters not available
     ///
     /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
     ///
     virtual void gText(uint16_t x0, uint16_t y0,
-                       String text,
+                       const String & text,
                        uint16_t textColour = myColours.black,
                        uint16_t backColour = myColours.white);
 
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates)
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text null-terminated string
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @note No heap allocation
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gText(uint16_t x0, uint16_t y0,
+               const char * text,
+               uint16_t textColour = myColours.black,
+               uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with length
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text UTF-8 string, not necessarily null-terminated
+    /// @param length number of bytes to draw
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @note No heap allocation
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gText(uint16_t x0, uint16_t y0,
+               const char * text, uint16_t length,
+               uint16_t textColour, uint16_t backColour);
+
+    ///
+    /// @brief Draw formatted ASCII Text (pixel coordinates)
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param format format with standard codes
+    /// @param ... list of values
+    /// @note Black text on white background
+    /// @note Formatted on the stack into TEXT_FORMAT_SIZE characters, no heap allocation
+    /// @see http://www.cplusplus.com/reference/cstdio/printf/?kw=printf for codes
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gTextf(uint16_t x0, uint16_t y0, const char * format, ...);
+
     ///
     /// @brief Draw ASCII Text (pixel coordinates) with selection of size
     /// @param x0 point coordinate, x-axis
@@ -363,9 +631,86 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
     ///
     virtual void gTextLarge(uint16_t x0, uint16_t y0,
-                            String text,
+                            const String & text,
                             uint16_t textColour = myColours.black,
                             uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with double size
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text null-terminated string
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @note No heap allocation
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gTextLarge(uint16_t x0, uint16_t y0,
+                    const char * text,
+                    uint16_t textColour = myColours.black,
+                    uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw fixed-point number (pixel coordinates)
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param value fixed-point value, ie. value x10^decimals
+    /// @param decimals number of decimals, default = 0
+    /// @param width field width in characters, including sign and unit, default = 0 = no padding
+    /// @param align ALIGN_LEFT, ALIGN_CENTER or ALIGN_RIGHT, default = ALIGN_RIGHT
+    /// @param unit null-terminated suffix, default = none
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @note Digits are sent to the glyph renderer directly, with no string and no floating-point
+    /// @n Example: gNumber(x, y, 215, 1, 6, ALIGN_RIGHT, "%") displays "  21.5%"
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gNumber(uint16_t x0, uint16_t y0,
+                 int32_t value, uint8_t decimals = 0,
+                 uint8_t width = 0, uint8_t align = ALIGN_RIGHT,
+                 const char * unit = nullptr,
+                 uint16_t textColour = myColours.black,
+                 uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw fixed-point number (pixel coordinates) with double size
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param value fixed-point value, ie. value x10^decimals
+    /// @param decimals number of decimals, default = 0
+    /// @param width field width in characters, including sign and unit, default = 0 = no padding
+    /// @param align ALIGN_LEFT, ALIGN_CENTER or ALIGN_RIGHT, default = ALIGN_RIGHT
+    /// @param unit null-terminated suffix, default = none
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @see gNumber()
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gNumberLarge(uint16_t x0, uint16_t y0,
+                      int32_t value, uint8_t decimals = 0,
+                      uint8_t width = 0, uint8_t align = ALIGN_RIGHT,
+                      const char * unit = nullptr,
+                      uint16_t textColour = myColours.black,
+                      uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Draw ASCII Text (pixel coordinates) with double size and length
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text UTF-8 string, not necessarily null-terminated
+    /// @param length number of bytes to draw
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @note No heap allocation
+    ///
+    /// @n @b More: @ref Colour, @ref Fonts, @ref Coordinate
+    ///
+    void gTextLarge(uint16_t x0, uint16_t y0,
+                    const char * text, uint16_t length,
+                    uint16_t textColour, uint16_t backColour);
     /// @}
 
     //
@@ -405,6 +750,20 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     virtual void s_setPoint(uint16_t x1, uint16_t y1, uint16_t colour) = 0; // compulsory
 
+    ///
+    /// @brief Set area
+    /// @param x1 top left coordinate, x-axis
+    /// @param y1 top left coordinate, y-axis
+    /// @param x2 bottom right coordinate, x-axis, x2 >= x1
+    /// @param y2 bottom right coordinate, y-axis, y2 >= y1
+    /// @param colour 16-bit colour
+    /// @note Used by line() for horizontal and vertical lines and by rectangle() with solid pen,
+    /// so also by circle() and triangle() with solid pen
+    /// @note Default implementation calls s_setPoint() for each pixel
+    /// @n @b More: @ref Colour, @ref Coordinate
+    ///
+    virtual void s_setArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t colour);
+
     // Write and Read
 
     // Other functions
@@ -430,6 +789,78 @@ class hV_Screen_Buffer : protected hV_Font_Terminal
     ///
     uint8_t s_getCharacter(uint8_t character, uint8_t index);
 
+    ///
+    /// @brief Draw characters, common to all gText() variants
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param text UTF-8 string, not necessarily null-terminated
+    /// @param length number of bytes to draw
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @param scale 1 = normal, 2 = large
+    /// @return horizontal size drawn, in pixels
+    ///
+    virtual uint16_t s_drawText(uint16_t x0, uint16_t y0,
+                                const char * text, uint16_t length,
+                                uint16_t textColour, uint16_t backColour,
+                                uint8_t scale);
+
+    ///
+    /// @brief Draw fixed-point number, common to gNumber() variants
+    /// @param x0 point coordinate, x-axis
+    /// @param y0 point coordinate, y-axis
+    /// @param value fixed-point value
+    /// @param decimals number of decimals
+    /// @param width field width in characters
+    /// @param align alignment
+    /// @param unit null-terminated suffix or nullptr
+    /// @param textColour 16-bit colour
+    /// @param backColour 16-bit colour
+    /// @param scale 1 = normal, 2 = large
+    ///
+    void s_drawNumber(uint16_t x0, uint16_t y0,
+                      int32_t value, uint8_t decimals,
+                      uint8_t width, uint8_t align,
+                      const char * unit,
+                      uint16_t textColour, uint16_t backColour,
+                      uint8_t scale);
+
+#if (DISPLAY_LIST == USE_DISPLAY_LIST_YES)
+    // Display list
+    ///
+    /// @brief Record a command into the display list
+    /// @param command command, with start set by the function for text
+    /// @param text UTF-8 string for text, nullptr otherwise
+    /// @return RESULT_SUCCESS = false = recorded, RESULT_ERROR = true = to be drawn immediately
+    /// @note A full list is rasterised and the next commands are drawn immediately until flush()
+    ///
+    bool s_recordCommand(displayCommand_s & command, const char * text = nullptr);
+
+    ///
+    /// @brief Area covered by a command
+    /// @param command command
+    /// @return area, with current orientation
+    ///
+    area_s s_getCommandArea(const displayCommand_s & command);
+
+    ///
+    /// @brief Draw a command
+    /// @param command command
+    /// @param text texts of the list
+    ///
+    void s_drawCommand(const displayCommand_s & command, const char * text);
+
+    displayCommand_s s_listCommand[DISPLAY_LIST_SIZE];
+    displayCommand_s s_listPrevious[DISPLAY_LIST_SIZE];
+    char s_listText[DISPLAY_LIST_TEXT];
+    char s_listPreviousText[DISPLAY_LIST_TEXT];
+    uint16_t s_listNumber, s_listPreviousNumber, s_listTextLength;
+    bool s_listFlagRecord, s_listFlagOverflow, s_listFlagPrevious, s_listFlagClip;
+    uint8_t s_listOrientation;
+    area_s s_listClip;
+    displayListStatistics_s s_listStatistics;
+#endif // DISPLAY_LIST
+
     uint8_t * s_newImage;
 
     // Variables provided by hV_Screen_Virtual
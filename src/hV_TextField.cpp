@@ -0,0 +1,264 @@
+//
+// hV_TextField.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 21 Jun 2025
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence All rights reserved
+//
+// Release 830: Initial release
+//
+
+// Library header
+#include "hV_TextField.h"
+
+hV_TextField::hV_TextField(hV_Screen_Buffer * screen)
+{
+    m_screen = screen;
+    m_x0 = 0;
+    m_y0 = 0;
+    m_cells = 0;
+    m_font = 0;
+    m_scale = 1;
+    m_textColour = myColours.black;
+    m_backColour = myColours.white;
+    m_cellX = 0;
+    m_cellY = 0;
+    m_flagValid = false;
+    m_dirty = { 0, 0, 0, 0 };
+}
+
+void hV_TextField::setField(uint16_t x0, uint16_t y0, uint8_t cells, uint8_t font, uint8_t scale)
+{
+    if (cells > TEXT_FIELD_MAX_CELLS)
+    {
+        cells = TEXT_FIELD_MAX_CELLS;
+    }
+    if (scale < 1)
+    {
+        scale = 1;
+    }
+
+    if ((x0 != m_x0) or (y0 != m_y0) or (cells != m_cells) or (font != m_font) or (scale != m_scale))
+    {
+        m_x0 = x0;
+        m_y0 = y0;
+        m_cells = cells;
+        m_font = font;
+        m_scale = scale;
+        m_flagValid = false;
+    }
+
+    uint8_t oldFont = m_screen->getFont();
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(m_font);
+    }
+    m_measure();
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(oldFont);
+    }
+}
+
+void hV_TextField::setColours(uint16_t textColour, uint16_t backColour)
+{
+    if ((textColour != m_textColour) or (backColour != m_backColour))
+    {
+        m_textColour = textColour;
+        m_backColour = backColour;
+        m_flagValid = false;
+    }
+}
+
+void hV_TextField::invalidate()
+{
+    m_flagValid = false;
+}
+
+uint8_t hV_TextField::update(const char * text)
+{
+    return m_update(text, strlen(text), 0);
+}
+
+uint8_t hV_TextField::update(const char * text, uint16_t length)
+{
+    return m_update(text, length, 0);
+}
+
+uint8_t hV_TextField::updateNumber(int32_t value, uint8_t decimals, uint8_t align, const char * unit)
+{
+    // Same format as hV_Screen_Buffer::s_drawNumber(), into a buffer
+    const uint32_t powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+    char work[TEXT_FORMAT_SIZE];
+    uint16_t length = 0;
+
+    bool flagNegative = (value < 0);
+    uint32_t magnitude = flagNegative ? (uint32_t)(-(value + 1)) + 1 : (uint32_t)value;
+
+    if (decimals > 9)
+    {
+        decimals = 9;
+    }
+
+    uint8_t digits = 1;
+    while ((digits < 10) and (magnitude >= powers[digits]))
+    {
+        digits += 1;
+    }
+    if (digits < decimals + 1)
+    {
+        digits = decimals + 1;
+    }
+
+    if (flagNegative)
+    {
+        work[length++] = '-';
+    }
+
+    for (uint8_t index = digits; index > 0; index -= 1)
+    {
+        if (index == decimals)
+        {
+            work[length++] = '.';
+        }
+        work[length++] = '0' + (magnitude / powers[index - 1]) % 10;
+    }
+
+    uint8_t count = length; // ASCII so far
+    if (unit != nullptr)
+    {
+        uint16_t index = 0;
+        uint16_t unitLength = strlen(unit);
+        if (unitLength > sizeof(work) - length)
+        {
+            unitLength = sizeof(work) - length;
+        }
+        memcpy(work + length, unit, unitLength);
+        length += unitLength;
+
+        while (index < unitLength)
+        {
+            utf8CodePoint(unit, unitLength, index);
+            count += 1;
+        }
+    }
+
+    // Padding, after is implicit
+    uint8_t padBefore = 0;
+    if (m_cells > count)
+    {
+        if (align == ALIGN_CENTER)
+        {
+            padBefore = (m_cells - count) / 2;
+        }
+        else if (align != ALIGN_LEFT)
+        {
+            padBefore = m_cells - count;
+        }
+    }
+
+    return m_update(work, length, padBefore);
+}
+
+area_s hV_TextField::getArea()
+{
+    area_s result = { m_x0, m_y0, (uint16_t)(m_cells * m_cellX), m_cellY };
+    return result;
+}
+
+area_s hV_TextField::getDirty()
+{
+    return m_dirty;
+}
+
+void hV_TextField::m_measure()
+{
+    // Widest character as drawn by gText()
+    m_cellX = m_screen->characterSizeX();
+    m_cellX *= m_scale;
+    m_cellY = m_screen->characterSizeY() * m_scale;
+}
+
+uint8_t hV_TextField::m_update(const char * text, uint16_t length, uint8_t padBefore)
+{
+    uint8_t result = 0;
+    m_dirty = { 0, 0, 0, 0 };
+
+    uint8_t oldFont = m_screen->getFont();
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(m_font);
+    }
+
+    if (not m_flagValid)
+    {
+        m_measure();
+    }
+
+    bool oldFontSolid = m_screen->getFontSolid();
+    m_screen->setFontSolid(true);
+
+    uint16_t index = 0;
+    for (uint8_t cell = 0; cell < m_cells; cell += 1)
+    {
+        uint32_t codePoint = ' ';
+        const char * cellText = " ";
+        uint16_t start = index;
+
+        if ((cell >= padBefore) and (index < length))
+        {
+            codePoint = utf8CodePoint(text, length, index);
+            cellText = text + start;
+        }
+
+        if ((not m_flagValid) or (codePoint != m_codePoint[cell]))
+        {
+            m_codePoint[cell] = codePoint;
+            m_drawCell(cell, cellText, (index > start) ? index - start : 1);
+            result += 1;
+        }
+    }
+
+    m_flagValid = true;
+    m_screen->setFontSolid(oldFontSolid);
+
+    if (oldFont != m_font)
+    {
+        m_screen->selectFont(oldFont);
+    }
+
+    return result;
+}
+
+void hV_TextField::m_drawCell(uint8_t cell, const char * text, uint8_t length)
+{
+    uint16_t x = m_x0 + cell * m_cellX;
+
+    if (m_scale > 1)
+    {
+        m_screen->gTextLarge(x, m_y0, text, length, m_textColour, m_backColour);
+    }
+    else
+    {
+        m_screen->gText(x, m_y0, text, length, m_textColour, m_backColour);
+    }
+
+    // Proportional font, clear the rest of the cell
+    uint16_t width = m_screen->stringSizeX(text, length) * m_scale;
+    if (width < m_cellX)
+    {
+        bool oldPenSolid = m_screen->getPenSolid();
+        m_screen->setPenSolid(true);
+        m_screen->dRectangle(x + width, m_y0, m_cellX - width, m_cellY, m_backColour);
+        m_screen->setPenSolid(oldPenSolid);
+    }
+
+    addArea(m_dirty, x, m_y0, m_cellX, m_cellY);
+}
+
@@ -0,0 +1,189 @@
+///
+/// @file hV_TextField.h
+/// @brief Text field with redraw of the changed cells only
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Single-line text split into character cells of fixed width
+/// * Previous content, font and position kept
+/// * Only the cells that differ are drawn again, with opaque glyphs
+/// * Area modified reported for partial or skipped refresh
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+#ifndef hV_TEXT_FIELD_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_TEXT_FIELD_RELEASE 830
+
+// Objects
+//
+///
+/// @brief Class for text field
+/// @details The field is a line of cells, one character per cell.
+/// On update, each cell is compared with its previous content
+/// and only the cells that differ are drawn again.
+///
+/// @note Cells are as wide as the widest character of the font,
+/// plus the space between characters for proportional fonts
+/// @note Call invalidate() after clear() or after drawing over the field
+///
+/// @n Example
+/// @code {.cpp}
+/// hV_TextField myField(&myScreen);
+/// myField.setField(10, 10, 6, Font_Terminal12x16);
+/// myField.updateNumber(215, 1, ALIGN_RIGHT, "oC"); // " 21.5oC", 7 cells drawn
+/// myField.updateNumber(216, 1, ALIGN_RIGHT, "oC"); // " 21.6oC", 1 cell drawn
+/// area_s area = myField.getDirty();
+/// @endcode
+///
+class hV_TextField
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_TextField(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the field
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param cells number of characters, up to TEXT_FIELD_MAX_CELLS
+    /// @param font font number, 0..fontMax()-1
+    /// @param scale 1 = normal, 2 = large, default = 1
+    /// @note A new position, size or font redraws all the cells at next update
+    ///
+    void setField(uint16_t x0, uint16_t y0, uint8_t cells, uint8_t font, uint8_t scale = 1);
+
+    ///
+    /// @brief Set the colours
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    /// @note New colours redraw all the cells at next update
+    ///
+    void setColours(uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Force a redraw of all the cells at next update
+    ///
+    void invalidate();
+
+    ///
+    /// @brief Update the text
+    /// @param text null-terminated UTF-8 string
+    /// @return number of cells drawn, 0 = unchanged
+    /// @note Text shorter than the field is padded with spaces, text longer is cut
+    ///
+    uint8_t update(const char * text);
+
+    ///
+    /// @brief Update the text with length
+    /// @param text UTF-8 string, not necessarily null-terminated
+    /// @param length number of bytes
+    /// @return number of cells drawn, 0 = unchanged
+    ///
+    uint8_t update(const char * text, uint16_t length);
+
+    ///
+    /// @brief Update with a fixed-point number
+    /// @param value fixed-point value, ie. value x10^decimals
+    /// @param decimals number of decimals, default = 0
+    /// @param align ALIGN_LEFT, ALIGN_CENTER or ALIGN_RIGHT, default = ALIGN_RIGHT
+    /// @param unit null-terminated suffix, default = none
+    /// @return number of cells drawn, 0 = unchanged
+    /// @note Same format as gNumber() with the number of cells as width
+    ///
+    uint8_t updateNumber(int32_t value, uint8_t decimals = 0, uint8_t align = ALIGN_RIGHT, const char * unit = nullptr);
+
+    ///
+    /// @brief Area of the field
+    /// @return area covered by all the cells
+    ///
+    area_s getArea();
+
+    ///
+    /// @brief Area modified by the last update
+    /// @return smallest area containing the cells drawn, dx = 0 if none
+    ///
+    area_s getDirty();
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Size of the cells for the current font
+    ///
+    void m_measure();
+
+    ///
+    /// @brief Update the cells
+    /// @param text UTF-8 string, not necessarily null-terminated
+    /// @param length number of bytes
+    /// @param padBefore number of spaces before the text
+    /// @return number of cells drawn
+    ///
+    uint8_t m_update(const char * text, uint16_t length, uint8_t padBefore);
+
+    ///
+    /// @brief Draw one cell
+    /// @param cell cell number
+    /// @param text UTF-8 bytes of the character
+    /// @param length number of bytes
+    ///
+    void m_drawCell(uint8_t cell, const char * text, uint8_t length);
+
+    hV_Screen_Buffer * m_screen;
+    uint16_t m_x0, m_y0;
+    uint8_t m_cells;
+    uint8_t m_font;
+    uint8_t m_scale;
+    uint16_t m_textColour, m_backColour;
+    uint16_t m_cellX, m_cellY;
+    bool m_flagValid;
+
+    uint32_t m_codePoint[TEXT_FIELD_MAX_CELLS];
+    area_s m_dirty;
+
+    /// @endcond
+};
+
+#endif // hV_TEXT_FIELD_RELEASE
+
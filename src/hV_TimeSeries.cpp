@@ -0,0 +1,147 @@
+//
+// hV_TimeSeries.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 21 Jun 2025
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence All rights reserved
+//
+// Release 830: Initial release
+//
+
+// Library header
+#include "hV_TimeSeries.h"
+
+hV_TimeSeries::hV_TimeSeries()
+{
+    clear();
+}
+
+void hV_TimeSeries::clear()
+{
+    for (uint8_t level = 0; level < TIME_SERIES_LEVELS; level += 1)
+    {
+        m_total[level] = 0;
+        m_sum[level] = 0;
+        m_minimum[level] = INT16_MAX;
+        m_maximum[level] = INT16_MIN;
+        m_number[level] = 0;
+    }
+}
+
+void hV_TimeSeries::add(int16_t value)
+{
+    m_sample[m_total[0] % TIME_SERIES_SIZE] = value;
+    m_total[0] += 1;
+
+    m_addEntry(1, { value, value, value });
+}
+
+void hV_TimeSeries::m_addEntry(uint8_t level, timeSample_s entry)
+{
+    // Accumulated from the level below
+    uint8_t below = level - 1;
+    m_sum[below] += entry.mean;
+    m_minimum[below] = hV_HAL_min(m_minimum[below], entry.minimum);
+    m_maximum[below] = hV_HAL_max(m_maximum[below], entry.maximum);
+    m_number[below] += 1;
+
+    if (m_number[below] < TIME_SERIES_FACTOR)
+    {
+        return;
+    }
+
+    // Rounded to nearest
+    int32_t sum = m_sum[below];
+    int16_t mean = (sum >= 0) ? (sum + TIME_SERIES_FACTOR / 2) / TIME_SERIES_FACTOR : (sum - TIME_SERIES_FACTOR / 2) / TIME_SERIES_FACTOR;
+    timeSample_s result = { m_minimum[below], m_maximum[below], mean };
+
+    m_sum[below] = 0;
+    m_minimum[below] = INT16_MAX;
+    m_maximum[below] = INT16_MIN;
+    m_number[below] = 0;
+
+    m_entry[level - 1][m_total[level] % TIME_SERIES_SIZE] = result;
+    m_total[level] += 1;
+
+    if (level + 1 < TIME_SERIES_LEVELS)
+    {
+        m_addEntry(level + 1, result);
+    }
+}
+
+uint16_t hV_TimeSeries::getCount(uint8_t level)
+{
+    if (level >= TIME_SERIES_LEVELS)
+    {
+        return 0;
+    }
+
+    return hV_HAL_min(m_total[level], (uint32_t)TIME_SERIES_SIZE);
+}
+
+uint32_t hV_TimeSeries::getTotal(uint8_t level)
+{
+    if (level >= TIME_SERIES_LEVELS)
+    {
+        return 0;
+    }
+
+    return m_total[level];
+}
+
+timeSample_s hV_TimeSeries::getSample(uint16_t index, uint8_t level)
+{
+    timeSample_s result = { 0, 0, 0 };
+    uint16_t count = getCount(level);
+
+    if (index >= count)
+    {
+        return result;
+    }
+
+    uint16_t position = (m_total[level] - count + index) % TIME_SERIES_SIZE;
+    if (level == 0)
+    {
+        int16_t value = m_sample[position];
+        result = { value, value, value };
+    }
+    else
+    {
+        result = m_entry[level - 1][position];
+    }
+
+    return result;
+}
+
+timeSample_s hV_TimeSeries::getSummary(uint8_t level)
+{
+    timeSample_s result = { 0, 0, 0 };
+    uint16_t count = getCount(level);
+
+    if (count == 0)
+    {
+        return result;
+    }
+
+    int32_t sum = 0;
+    result.minimum = INT16_MAX;
+    result.maximum = INT16_MIN;
+
+    for (uint16_t index = 0; index < count; index += 1)
+    {
+        timeSample_s entry = getSample(index, level);
+        result.minimum = hV_HAL_min(result.minimum, entry.minimum);
+        result.maximum = hV_HAL_max(result.maximum, entry.maximum);
+        sum += entry.mean;
+    }
+    result.mean = sum / count;
+
+    return result;
+}
+
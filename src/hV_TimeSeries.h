@@ -0,0 +1,158 @@
+///
+/// @file hV_TimeSeries.h
+/// @brief Time series of fixed-point samples with rollups
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Samples kept in ring buffers of fixed size
+/// * Level 0: last TIME_SERIES_SIZE samples
+/// * Levels 1 and more: minimum, maximum and mean of TIME_SERIES_FACTOR entries of the level below
+/// * No allocation, size set by TIME_SERIES_SIZE, TIME_SERIES_LEVELS and TIME_SERIES_FACTOR
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+#if (TIME_SERIES_LEVELS < 2)
+#error Required TIME_SERIES_LEVELS 2 or more
+#endif // TIME_SERIES_LEVELS
+
+#ifndef hV_TIME_SERIES_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_TIME_SERIES_RELEASE 830
+
+///
+/// @brief Entry of a time series
+/// @details Same value for minimum, maximum and mean at level 0
+///
+struct timeSample_s
+{
+    int16_t minimum; ///< minimum value
+    int16_t maximum; ///< maximum value
+    int16_t mean; ///< mean value
+};
+
+// Objects
+//
+///
+/// @brief Class for time series
+/// @details Samples are fixed-point integers, with a scale chosen by the application,
+/// eg. 215 for 21.5 °C with scale 10
+///
+/// @note Entries are numbered from the first sample added,
+/// so a chart can tell the new entries from the ones already drawn
+///
+/// @n Example
+/// @code {.cpp}
+/// hV_TimeSeries myTemperatures;
+///
+/// myTemperatures.add(215); // 21.5 °C
+/// timeSample_s latest = myTemperatures.getSample(myTemperatures.getCount(2) - 1, 2); // last entry of level 2
+/// @endcode
+///
+class hV_TimeSeries
+{
+  public:
+    ///
+    /// @brief Constructor
+    ///
+    hV_TimeSeries();
+
+    ///
+    /// @brief Remove all the samples
+    ///
+    void clear();
+
+    ///
+    /// @brief Add a sample
+    /// @param value fixed-point value
+    /// @note Entries of the levels above are added every TIME_SERIES_FACTOR entries
+    ///
+    void add(int16_t value);
+
+    ///
+    /// @brief Number of entries available
+    /// @param level 0 = samples, default, up to TIME_SERIES_LEVELS - 1
+    /// @return number of entries, up to TIME_SERIES_SIZE
+    ///
+    uint16_t getCount(uint8_t level = 0);
+
+    ///
+    /// @brief Number of entries added since clear()
+    /// @param level 0 = samples, default, up to TIME_SERIES_LEVELS - 1
+    /// @return number of entries, the last one being getTotal() - 1
+    ///
+    uint32_t getTotal(uint8_t level = 0);
+
+    ///
+    /// @brief Entry
+    /// @param index 0 = oldest available, up to getCount() - 1
+    /// @param level 0 = samples, default, up to TIME_SERIES_LEVELS - 1
+    /// @return minimum, maximum and mean
+    ///
+    timeSample_s getSample(uint16_t index, uint8_t level = 0);
+
+    ///
+    /// @brief Summary of the entries available
+    /// @param level 0 = samples, default, up to TIME_SERIES_LEVELS - 1
+    /// @return minimum, maximum and mean of the entries available
+    ///
+    timeSample_s getSummary(uint8_t level = 0);
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Add an entry to a level above the samples
+    /// @param level 1 and more
+    /// @param entry minimum, maximum and mean
+    ///
+    void m_addEntry(uint8_t level, timeSample_s entry);
+
+    int16_t m_sample[TIME_SERIES_SIZE];
+    timeSample_s m_entry[TIME_SERIES_LEVELS - 1][TIME_SERIES_SIZE];
+    uint32_t m_total[TIME_SERIES_LEVELS]; // entries added per level
+
+    // Entry of the level above being accumulated
+    int32_t m_sum[TIME_SERIES_LEVELS];
+    int16_t m_minimum[TIME_SERIES_LEVELS];
+    int16_t m_maximum[TIME_SERIES_LEVELS];
+    uint8_t m_number[TIME_SERIES_LEVELS];
+
+    /// @endcond
+};
+
+#endif // hV_TIME_SERIES_RELEASE
+
@@ -16,6 +16,10 @@
 //
 // Release 700: Refactored screen and board functions
 // Release 803: Added types for string and frame-buffer
+// Release 830: Made formatString() reentrant
+// Release 830: Added streaming UTF-8 decoder
+// Release 830: Added area utilities
+// Release 830: Added frame compression
 //
 
 // Library header
@@ -29,21 +33,18 @@ void delay_ms(uint32_t ms)
     while (millis() < chrono);
 }
 
-char bufferIn[128];
-char bufferOut[128];
-
 // Code
 // Utilities
 
 STRING_TYPE formatString(const char * format, ...)
 {
-    memset(&bufferOut, 0x00, sizeof(bufferOut));
+    char work[128] = {0}; // local, reentrant
     va_list args;
     va_start(args, format);
-    vsnprintf(bufferOut, 127, format, args);
+    vsnprintf(work, sizeof(work), format, args);
     va_end(args);
 
-    return String(bufferOut);
+    return String(work);
 }
 
 STRING_TYPE trimString(STRING_TYPE text)
@@ -159,40 +160,80 @@ int32_t sin32x100(int32_t degreesX100)
 
 STRING_TYPE utf2iso(STRING_TYPE s)
 {
-    uint8_t c;
-
-    s.toCharArray(bufferIn, s.length() + 1);
-    // strcpy(bufferIn, s.c_str());
+    STRING_TYPE result = "";
+    result.reserve(s.length());
 
-    memset(&bufferOut, 0x00, sizeof(bufferOut));
+    const char * text = s.c_str();
+    uint16_t length = s.length();
+    uint16_t index = 0;
+    uint32_t codePoint;
 
-    for (uint8_t i = 0; i < strlen(bufferIn); i++)
+    // Single pass, no intermediate buffer
+    while (index < length)
     {
-        c = (uint8_t)bufferIn[i];
+        codePoint = utf8CodePoint(text, length, index);
 
-        if (c < 0x80)
-        {
-            bufferOut[strlen(bufferOut)] = c;
-        }
-        else if (c == 0xc3)
+        if (codePoint < 0x0100)
         {
-            bufferOut[strlen(bufferOut)] = (bufferIn[++i] + 64);
+            result += (char)codePoint;
         }
-        else if (c == 0xc2)
+        else if (codePoint == 0x20ac) // Euro
         {
-            bufferOut[strlen(bufferOut)] = bufferIn[++i];
+            result += (char)0x80;
         }
-        else if (c == 0xe2)
+        // Otherwise, not available in ISO-8859-1
+    }
+
+    return result;
+}
+
+uint32_t utf8CodePoint(const char * text, uint16_t length, uint16_t & index)
+{
+    uint8_t c = (uint8_t)text[index];
+    uint8_t size = 0;
+    uint32_t codePoint = 0;
+
+    if (c < 0x80)
+    {
+        index += 1;
+        return c;
+    }
+    else if ((c & 0xe0) == 0xc0)
+    {
+        size = 2;
+        codePoint = c & 0x1f;
+    }
+    else if ((c & 0xf0) == 0xe0)
+    {
+        size = 3;
+        codePoint = c & 0x0f;
+    }
+    else if ((c & 0xf8) == 0xf0)
+    {
+        size = 4;
+        codePoint = c & 0x07;
+    }
+
+    // Check continuation bytes, otherwise ISO-8859-1 fall-back
+    if ((size == 0) or (index + size > length))
+    {
+        index += 1;
+        return c;
+    }
+
+    for (uint8_t i = 1; i < size; i += 1)
+    {
+        uint8_t next = (uint8_t)text[index + i];
+        if ((next & 0xc0) != 0x80)
         {
-            if ((bufferIn[i + 1] == 0x82) && (bufferIn[i + 2] == 0xac))
-            {
-                bufferOut[strlen(bufferOut)] = 0x80;
-                i += 2;
-            }
+            index += 1;
+            return c;
         }
+        codePoint = (codePoint << 6) | (next & 0x3f);
     }
 
-    return bufferOut;
+    index += size;
+    return codePoint;
 }
 
 uint16_t checkRange(uint16_t value, uint16_t valueMin, uint16_t valueMax)
@@ -225,3 +266,147 @@ uint32_t roundUp(uint32_t value, uint16_t modulo)
     return result;
 }
 
+void addArea(area_s & area, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    if ((dx == 0) or (dy == 0))
+    {
+        return;
+    }
+
+    if ((area.dx == 0) or (area.dy == 0))
+    {
+        area = { x0, y0, dx, dy };
+        return;
+    }
+
+    uint16_t x1 = area.x0 + area.dx;
+    uint16_t y1 = area.y0 + area.dy;
+    if (x0 + dx > x1)
+    {
+        x1 = x0 + dx;
+    }
+    if (y0 + dy > y1)
+    {
+        y1 = y0 + dy;
+    }
+    if (x0 < area.x0)
+    {
+        area.x0 = x0;
+    }
+    if (y0 < area.y0)
+    {
+        area.y0 = y0;
+    }
+    area.dx = x1 - area.x0;
+    area.dy = y1 - area.y0;
+}
+
+void addArea(area_s & area, const area_s & other)
+{
+    addArea(area, other.x0, other.y0, other.dx, other.dy);
+}
+
+// Difference with the line before
+static uint8_t frameDelta(const uint8_t * buffer, uint32_t index, uint16_t sizeH)
+{
+    return (index < sizeH) ? buffer[index] : (buffer[index] ^ buffer[index - sizeH]);
+}
+
+uint32_t frameEncode(const uint8_t * buffer, uint32_t size, uint16_t sizeH, uint8_t * data, uint32_t capacity)
+{
+    uint32_t index = 0;
+    uint32_t length = 0;
+
+    while (index < size)
+    {
+        uint8_t value = frameDelta(buffer, index, sizeH);
+        uint32_t number = 1;
+        while ((index + number < size) and (number < 128) and (frameDelta(buffer, index + number, sizeH) == value))
+        {
+            number += 1;
+        }
+
+        if (number >= 3)
+        {
+            // Run
+            if (data != nullptr)
+            {
+                if (length + 2 > capacity)
+                {
+                    return 0;
+                }
+                data[length] = 0x80 | (number - 1);
+                data[length + 1] = value;
+            }
+            length += 2;
+            index += number;
+        }
+        else
+        {
+            // Literal, up to the next run of 3 bytes
+            uint32_t start = length + 1;
+            number = 0;
+            while ((index < size) and (number < 128))
+            {
+                value = frameDelta(buffer, index, sizeH);
+                if ((index + 2 < size) and (frameDelta(buffer, index + 1, sizeH) == value) and (frameDelta(buffer, index + 2, sizeH) == value))
+                {
+                    break;
+                }
+                if (data != nullptr)
+                {
+                    if (start + number >= capacity)
+                    {
+                        return 0;
+                    }
+                    data[start + number] = value;
+                }
+                index += 1;
+                number += 1;
+            }
+
+            if (data != nullptr)
+            {
+                data[length] = number - 1;
+            }
+            length += 1 + number;
+        }
+    }
+
+    return length;
+}
+
+void frameDecode(const uint8_t * data, uint32_t length, uint8_t * buffer, uint32_t size, uint16_t sizeH)
+{
+    uint32_t position = 0;
+    uint32_t index = 0;
+
+    while ((position < length) and (index < size))
+    {
+        uint8_t control = data[position];
+        uint32_t number = hV_HAL_min((uint32_t)(control & 0x7f) + 1, size - index);
+        position += 1;
+
+        if (control & 0x80)
+        {
+            // Run
+            uint8_t value = data[position];
+            position += 1;
+            for (uint32_t j = 0; j < number; j += 1)
+            {
+                buffer[index] = ((index < sizeH) ? 0x00 : buffer[index - sizeH]) ^ value;
+                index += 1;
+            }
+        }
+        else
+        {
+            // Literal
+            for (uint32_t j = 0; j < number; j += 1)
+            {
+                buffer[index] = ((index < sizeH) ? 0x00 : buffer[index - sizeH]) ^ data[position + j];
+                index += 1;
+            }
+            position += number;
+        }
+    }
+}
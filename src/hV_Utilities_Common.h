@@ -92,6 +92,17 @@ int32_t sin32x100(int32_t degreesX100);
 ///
 STRING_TYPE utf2iso(STRING_TYPE s);
 
+///
+/// @brief Decode next UTF-8 code point
+/// @param text UTF-8 string, not necessarily null-terminated
+/// @param length number of bytes of text
+/// @param[out] index position of the byte to decode, moved to the next code point
+/// @return Unicode code point
+/// @note Invalid or truncated sequences fall back to ISO-8859-1, one byte per character,
+/// so strings already converted by utf2iso() are decoded unchanged
+///
+uint32_t utf8CodePoint(const char * text, uint16_t length, uint16_t & index);
+
 ///
 /// @brief Format string
 /// @details Based on vsprint
@@ -99,6 +110,7 @@ STRING_TYPE utf2iso(STRING_TYPE s);
 /// @param ... list of values
 /// @return string with values formatted
 /// @see http://www.cplusplus.com/reference/cstdio/printf/?kw=printf for codes
+/// @note Allocates a String on the heap, consider snprintf() or gTextf() instead
 ///
 STRING_TYPE formatString(const char * format, ...);
 
@@ -153,4 +165,74 @@ uint32_t roundUp(uint32_t value, uint16_t modulo);
 
 /// @}
 
+///
+/// @name Area
+/// @brief Rectangular area, used to report the part of the screen modified
+/// @{
+
+///
+/// @brief Rectangular area
+/// @note dx = 0 or dy = 0 means empty area
+///
+struct area_s
+{
+    uint16_t x0; ///< top left coordinate, x-axis
+    uint16_t y0; ///< top left coordinate, y-axis
+    uint16_t dx; ///< width, x-axis
+    uint16_t dy; ///< height, y-axis
+};
+
+///
+/// @brief Add a rectangle to an area
+/// @param area area to extend, set to the smallest area containing both
+/// @param x0 top left coordinate, x-axis
+/// @param y0 top left coordinate, y-axis
+/// @param dx width, x-axis
+/// @param dy height, y-axis
+/// @note An empty rectangle leaves the area unchanged
+///
+void addArea(area_s & area, uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+///
+/// @brief Add an area to an area
+/// @param area area to extend, set to the smallest area containing both
+/// @param other area to add
+///
+void addArea(area_s & area, const area_s & other);
+
+/// @}
+
+///
+/// @name Frame compression
+/// @brief Frame-buffer compressed as difference with the line before, then run-length encoding
+/// @details Control byte then data
+/// * 0x80 | (number - 1), value: run of 1..128 same bytes
+/// * number - 1, values: 1..128 literal bytes
+///
+/// @note Identical lines, eg. vertical edges of frames, give runs of 0x00
+/// @{
+
+///
+/// @brief Compress a frame
+/// @param buffer frame to compress
+/// @param size number of bytes of the frame
+/// @param sizeH number of bytes per line
+/// @param data buffer for the compressed frame, nullptr to compute the size only
+/// @param capacity number of bytes of data
+/// @return number of bytes of the compressed frame, 0 if larger than capacity
+///
+uint32_t frameEncode(const uint8_t * buffer, uint32_t size, uint16_t sizeH, uint8_t * data, uint32_t capacity);
+
+///
+/// @brief Decompress a frame
+/// @param data compressed frame
+/// @param length number of bytes of the compressed frame
+/// @param buffer frame, modified
+/// @param size number of bytes of the frame
+/// @param sizeH number of bytes per line
+///
+void frameDecode(const uint8_t * data, uint32_t length, uint8_t * buffer, uint32_t size, uint16_t sizeH);
+
+/// @}
+
 #endif // hV_UTILITIES_RELEASE
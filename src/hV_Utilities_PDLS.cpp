@@ -106,6 +106,8 @@ void hV_Utilities_PDLS::u_WhoAmI(char * answer)
     strcat(answer, "i");
 #elif (SRAM_MODE == USE_EXTERNAL_SPI)
     strcat(answer, "e");
+#elif (SRAM_MODE == USE_CHARACTER_CELLS)
+    strcat(answer, "c");
 #else
     strcat(answer, ".");
 #endif // SRAM_MODE
@@ -119,6 +121,10 @@ void hV_Utilities_PDLS::u_WhoAmI(char * answer)
 #else
     strcat(answer, ".");
 #endif // FONT_MODE
+
+#if (FONT_FLASH == USE_FONT_FLASH_YES)
+    strcat(answer, "F");
+#endif // FONT_FLASH
 }
 
 void hV_Utilities_PDLS::invert(bool flag)
@@ -191,7 +197,7 @@ STRING_TYPE hV_Utilities_PDLS::screenNumber()
     char work[64] = {0};
     u_screenNumber(work);
 
-    return formatString("%s", work);
+    return STRING_TYPE(work);
 }
 
 //
@@ -302,28 +308,34 @@ void hV_Utilities_PDLS::setPowerProfile(uint8_t mode, uint8_t scope)
 
 void hV_Utilities_PDLS::debugVariant(uint8_t contextFilm)
 {
+    char work[128];
+
     mySerial.println();
 
     switch (contextFilm)
     {
         case FILM_P: // BW, Embedded fast update
 
-            mySerial.println(formatString("hV * Screen %i-%cS-0%c with no fast update", u_codeSize, u_codeFilm, u_codeDriver));
+            snprintf(work, sizeof(work), "hV * Screen %i-%cS-0%c with no fast update", u_codeSize, u_codeFilm, u_codeDriver);
+            mySerial.println(work);
             break;
 
         case FILM_K: // BW, wide temperature and embedded fast update
 
-            mySerial.println(formatString("hV * Screen %i-%cS-0%c with no wide temperature and embedded fast update", u_codeSize, u_codeFilm, u_codeDriver));
+            snprintf(work, sizeof(work), "hV * Screen %i-%cS-0%c with no wide temperature and embedded fast update", u_codeSize, u_codeFilm, u_codeDriver);
+            mySerial.println(work);
             break;
 
         case FILM_Q: // BWRY
 
-            mySerial.println(formatString("hV * Screen %i-%cS-0%c is not black-white-red-yellow", u_codeSize, u_codeFilm, u_codeDriver));
+            snprintf(work, sizeof(work), "hV * Screen %i-%cS-0%c is not black-white-red-yellow", u_codeSize, u_codeFilm, u_codeDriver);
+            mySerial.println(work);
             break;
 
         default:
 
-            mySerial.println(formatString("hV * Screen %i-%cS-0%c is not supported", u_codeSize, u_codeFilm, u_codeDriver));
+            snprintf(work, sizeof(work), "hV * Screen %i-%cS-0%c is not supported", u_codeSize, u_codeFilm, u_codeDriver);
+            mySerial.println(work);
             break;
     } // u_codeFilm
 
@@ -331,22 +343,26 @@ void hV_Utilities_PDLS::debugVariant(uint8_t contextFilm)
     {
         case FILM_P: // BW, Embedded fast update
 
-            mySerial.println(formatString("hV * Use PDLS_EXT3_%s_%s instead", "Basic", "Fast"));
+            snprintf(work, sizeof(work), "hV * Use PDLS_EXT3_%s_%s instead", "Basic", "Fast");
+            mySerial.println(work);
             break;
 
         case FILM_K: // BW, wide temperature and embedded fast update
 
-            mySerial.println(formatString("hV * Use PDLS_EXT3_%s_%s instead", "Basic", "Wide"));
+            snprintf(work, sizeof(work), "hV * Use PDLS_EXT3_%s_%s instead", "Basic", "Wide");
+            mySerial.println(work);
             break;
 
         case FILM_Q: // BWRY
 
-            mySerial.println(formatString("hV * Use PDLS_EXT3_%s_%s instead", "Basic", "BWRY"));
+            snprintf(work, sizeof(work), "hV * Use PDLS_EXT3_%s_%s instead", "Basic", "BWRY");
+            mySerial.println(work);
             break;
 
         default:
 
-            mySerial.println(formatString("hV * Use PDLS_EXT3_%s_%s instead", "Basic", "Global"));
+            snprintf(work, sizeof(work), "hV * Use PDLS_EXT3_%s_%s instead", "Basic", "Global");
+            mySerial.println(work);
             break;
     } // u_codeFilm
 
@@ -0,0 +1,923 @@
+//
+// hV_Widget.cpp
+// Library C++ code
+// ----------------------------------
+//
+// Project Pervasive Displays Library Suite
+// Based on highView technology
+//
+// Created by Rei Vilo, 21 Jun 2025
+//
+// Copyright (c) Rei Vilo, 2010-2025
+// Licence All rights reserved
+//
+// Release 830: Initial release
+//
+
+// Library header
+#include "hV_Widget.h"
+
+// Checksum of the text, FNV-1a, same as hV_Layout
+static uint32_t widgetChecksum(const char * text)
+{
+    uint32_t result = 0x811c9dc5;
+    while (*text != 0x00)
+    {
+        result ^= (uint8_t)(*text);
+        result *= 0x01000193;
+        text++;
+    }
+    return result;
+}
+
+//
+// === Widget
+//
+hV_Widget::hV_Widget(hV_Screen_Buffer * screen)
+{
+    m_screen = screen;
+    m_x0 = 0;
+    m_y0 = 0;
+    m_dx = 0;
+    m_dy = 0;
+    m_textColour = myColours.black;
+    m_backColour = myColours.white;
+    m_flagInvalid = true;
+    m_flagChanged = false;
+    m_oldFont = 0;
+    m_oldFontSolid = false;
+    m_child = nullptr;
+    m_next = nullptr;
+}
+
+void hV_Widget::setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    if ((x0 != m_x0) or (y0 != m_y0) or (dx != m_dx) or (dy != m_dy))
+    {
+        m_x0 = x0;
+        m_y0 = y0;
+        m_dx = dx;
+        m_dy = dy;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_Widget::setColours(uint16_t textColour, uint16_t backColour)
+{
+    if ((textColour != m_textColour) or (backColour != m_backColour))
+    {
+        m_textColour = textColour;
+        m_backColour = backColour;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_Widget::addChild(hV_Widget * child)
+{
+    child->m_next = nullptr;
+
+    if (m_child == nullptr)
+    {
+        m_child = child;
+    }
+    else
+    {
+        hV_Widget * last = m_child;
+        while (last->m_next != nullptr)
+        {
+            last = last->m_next;
+        }
+        last->m_next = child;
+    }
+
+    child->m_flagInvalid = true;
+}
+
+void hV_Widget::invalidate()
+{
+    m_flagInvalid = true;
+}
+
+void hV_Widget::setValue(int32_t value)
+{
+    // No value
+}
+
+bool hV_Widget::isInvalid()
+{
+    if (m_flagInvalid or m_flagChanged)
+    {
+        return true;
+    }
+
+    for (hV_Widget * child = m_child; child != nullptr; child = child->m_next)
+    {
+        if (child->isInvalid())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+area_s hV_Widget::getArea()
+{
+    area_s result = { m_x0, m_y0, m_dx, m_dy };
+    return result;
+}
+
+area_s hV_Widget::render()
+{
+    area_s result = { 0, 0, 0, 0 };
+    m_render(result, false);
+    return result;
+}
+
+void hV_Widget::m_render(area_s & area, bool flagAll)
+{
+    flagAll |= m_flagInvalid;
+
+    if (flagAll or m_flagChanged)
+    {
+        addArea(area, m_draw(flagAll));
+    }
+    m_flagInvalid = false;
+    m_flagChanged = false;
+
+    // Children over the widget, drawn whole if the widget was
+    for (hV_Widget * child = m_child; child != nullptr; child = child->m_next)
+    {
+        child->m_render(area, flagAll);
+    }
+}
+
+void hV_Widget::m_clear()
+{
+    bool oldPenSolid = m_screen->getPenSolid();
+    m_screen->setPenSolid(true);
+    m_screen->dRectangle(m_x0, m_y0, m_dx, m_dy, m_backColour);
+    m_screen->setPenSolid(oldPenSolid);
+}
+
+void hV_Widget::m_selectFont(uint8_t font)
+{
+    m_oldFont = m_screen->getFont();
+    if (m_oldFont != font)
+    {
+        m_screen->selectFont(font);
+    }
+
+    m_oldFontSolid = m_screen->getFontSolid();
+    m_screen->setFontSolid(true);
+}
+
+void hV_Widget::m_restoreFont()
+{
+    if (m_oldFont != m_screen->getFont())
+    {
+        m_screen->selectFont(m_oldFont);
+    }
+
+    m_screen->setFontSolid(m_oldFontSolid);
+}
+
+//
+// === Panel
+//
+hV_WidgetPanel::hV_WidgetPanel(hV_Screen_Buffer * screen) : hV_Widget(screen)
+{
+    m_flagFrame = false;
+}
+
+void hV_WidgetPanel::setFrame(bool flag)
+{
+    if (flag != m_flagFrame)
+    {
+        m_flagFrame = flag;
+        m_flagInvalid = true;
+    }
+}
+
+area_s hV_WidgetPanel::m_draw(bool flagAll)
+{
+    m_clear();
+
+    if (m_flagFrame)
+    {
+        m_screen->dRectangle(m_x0, m_y0, m_dx, m_dy, m_textColour);
+    }
+
+    return getArea();
+}
+
+//
+// === Label
+//
+hV_WidgetLabel::hV_WidgetLabel(hV_Screen_Buffer * screen) : hV_Widget(screen)
+{
+    m_text = nullptr;
+    m_checksum = 0;
+    m_font = 0;
+    m_align = ALIGN_LEFT;
+}
+
+void hV_WidgetLabel::setFont(uint8_t font, uint8_t align)
+{
+    if ((font != m_font) or (align != m_align))
+    {
+        m_font = font;
+        m_align = align;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_WidgetLabel::setText(const char * text)
+{
+    uint32_t checksum = widgetChecksum(text);
+
+    if ((text != m_text) or (checksum != m_checksum))
+    {
+        m_text = text;
+        m_checksum = checksum;
+        m_flagChanged = true;
+    }
+}
+
+area_s hV_WidgetLabel::m_draw(bool flagAll)
+{
+    m_clear();
+
+    if (m_text != nullptr)
+    {
+        m_selectFont(m_font);
+
+        uint16_t width = m_screen->stringSizeX(m_text);
+        uint16_t height = m_screen->characterSizeY();
+        uint16_t x = m_x0;
+        uint16_t y = m_y0;
+
+        if (width < m_dx)
+        {
+            if (m_align == ALIGN_CENTER)
+            {
+                x += (m_dx - width) / 2;
+            }
+            else if (m_align == ALIGN_RIGHT)
+            {
+                x += m_dx - width;
+            }
+        }
+        if (height < m_dy)
+        {
+            y += (m_dy - height) / 2;
+        }
+
+        m_screen->gText(x, y, m_text, m_textColour, m_backColour);
+        m_restoreFont();
+    }
+
+    return getArea();
+}
+
+//
+// === Value
+//
+hV_WidgetValue::hV_WidgetValue(hV_Screen_Buffer * screen) : hV_Widget(screen), m_field(screen)
+{
+    m_value = 0;
+    m_font = 0;
+    m_cells = 0;
+    m_decimals = 0;
+    m_scale = 1;
+    m_unit = nullptr;
+}
+
+void hV_WidgetValue::setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy)
+{
+    setFormat(m_font, m_cells, m_decimals, m_unit, m_scale);
+
+    if ((x0 != m_x0) or (y0 != m_y0))
+    {
+        m_x0 = x0;
+        m_y0 = y0;
+        m_flagInvalid = true;
+    }
+
+    m_field.setField(m_x0, m_y0, m_cells, m_font, m_scale);
+    m_dx = m_field.getArea().dx;
+    m_dy = m_field.getArea().dy;
+}
+
+void hV_WidgetValue::setFormat(uint8_t font, uint8_t cells, uint8_t decimals, const char * unit, uint8_t scale)
+{
+    if ((font != m_font) or (cells != m_cells) or (decimals != m_decimals) or (unit != m_unit) or (scale != m_scale))
+    {
+        m_font = font;
+        m_cells = cells;
+        m_decimals = decimals;
+        m_unit = unit;
+        m_scale = scale;
+        m_flagInvalid = true;
+    }
+
+    m_field.setField(m_x0, m_y0, m_cells, m_font, m_scale);
+    m_dx = m_field.getArea().dx;
+    m_dy = m_field.getArea().dy;
+}
+
+void hV_WidgetValue::setValue(int32_t value)
+{
+    if (value != m_value)
+    {
+        m_value = value;
+        m_flagChanged = true;
+    }
+}
+
+area_s hV_WidgetValue::m_draw(bool flagAll)
+{
+    if (flagAll)
+    {
+        m_field.invalidate();
+    }
+
+    m_field.setColours(m_textColour, m_backColour);
+    m_field.updateNumber(m_value, m_decimals, ALIGN_RIGHT, m_unit);
+    return m_field.getDirty();
+}
+
+//
+// === Bar
+//
+hV_WidgetBar::hV_WidgetBar(hV_Screen_Buffer * screen) : hV_Widget(screen)
+{
+    m_minimum = 0;
+    m_maximum = 100;
+    m_value = 0;
+    m_drawn = 0xffff;
+}
+
+void hV_WidgetBar::setRange(int32_t minimum, int32_t maximum)
+{
+    if ((minimum != m_minimum) or (maximum != m_maximum))
+    {
+        m_minimum = minimum;
+        m_maximum = maximum;
+        m_flagChanged = true;
+    }
+}
+
+void hV_WidgetBar::setValue(int32_t value)
+{
+    m_value = value;
+
+    if (m_width(m_value) != m_drawn)
+    {
+        m_flagChanged = true;
+    }
+}
+
+uint16_t hV_WidgetBar::m_width(int32_t value)
+{
+    // Inside the frame
+    if ((m_dx < 3) or (m_maximum <= m_minimum) or (value <= m_minimum))
+    {
+        return 0;
+    }
+    if (value >= m_maximum)
+    {
+        return m_dx - 2;
+    }
+
+    return (int64_t)(value - m_minimum) * (m_dx - 2) / (m_maximum - m_minimum);
+}
+
+area_s hV_WidgetBar::m_draw(bool flagAll)
+{
+    area_s result = { 0, 0, 0, 0 };
+    uint16_t width = m_width(m_value);
+
+    if ((m_dx < 3) or (m_dy < 3))
+    {
+        return result;
+    }
+
+    bool oldPenSolid = m_screen->getPenSolid();
+    m_screen->setPenSolid(true);
+
+    if (flagAll or (m_drawn == 0xffff))
+    {
+        m_screen->dRectangle(m_x0, m_y0, m_dx, m_dy, m_backColour);
+        m_screen->dRectangle(m_x0 + 1, m_y0 + 1, width, m_dy - 2, m_textColour);
+        m_screen->setPenSolid(false);
+        m_screen->dRectangle(m_x0, m_y0, m_dx, m_dy, m_textColour);
+        result = getArea();
+    }
+    else if (width > m_drawn)
+    {
+        // Longer, fill the difference only
+        m_screen->dRectangle(m_x0 + 1 + m_drawn, m_y0 + 1, width - m_drawn, m_dy - 2, m_textColour);
+        addArea(result, m_x0 + 1 + m_drawn, m_y0 + 1, width - m_drawn, m_dy - 2);
+    }
+    else if (width < m_drawn)
+    {
+        // Shorter, clear the difference only
+        m_screen->dRectangle(m_x0 + 1 + width, m_y0 + 1, m_drawn - width, m_dy - 2, m_backColour);
+        addArea(result, m_x0 + 1 + width, m_y0 + 1, m_drawn - width, m_dy - 2);
+    }
+
+    m_screen->setPenSolid(oldPenSolid);
+    m_drawn = width;
+    return result;
+}
+
+//
+// === Icon
+//
+hV_WidgetIcon::hV_WidgetIcon(hV_Screen_Buffer * screen) : hV_Widget(screen)
+{
+    m_bitmap = nullptr;
+    m_width = 0;
+    m_height = 0;
+}
+
+void hV_WidgetIcon::setBitmap(const uint8_t * bitmap, uint16_t width, uint16_t height)
+{
+    if ((bitmap != m_bitmap) or (width != m_width) or (height != m_height))
+    {
+        m_bitmap = bitmap;
+        m_width = width;
+        m_height = height;
+        m_flagChanged = true;
+    }
+}
+
+area_s hV_WidgetIcon::m_draw(bool flagAll)
+{
+    m_clear();
+
+    if (m_bitmap != nullptr)
+    {
+        uint16_t bytesPerRow = (m_width + 7) / 8;
+        uint16_t x = m_x0 + ((m_width < m_dx) ? (m_dx - m_width) / 2 : 0);
+        uint16_t y = m_y0 + ((m_height < m_dy) ? (m_dy - m_height) / 2 : 0);
+
+        for (uint16_t j = 0; j < hV_HAL_min(m_height, m_dy); j += 1)
+        {
+            for (uint16_t i = 0; i < hV_HAL_min(m_width, m_dx); i += 1)
+            {
+                if (bitRead(m_bitmap[j * bytesPerRow + i / 8], 7 - (i % 8)))
+                {
+                    m_screen->point(x + i, y + j, m_textColour);
+                }
+            }
+        }
+    }
+
+    return getArea();
+}
+
+//
+// === QR-code
+//
+hV_WidgetQR::hV_WidgetQR(hV_Screen_Buffer * screen) : hV_Widget(screen)
+{
+    m_modules = nullptr;
+    m_size = 0;
+}
+
+void hV_WidgetQR::setModules(const uint8_t * modules, uint8_t size)
+{
+    m_modules = modules;
+    m_size = size;
+    m_flagChanged = true;
+}
+
+area_s hV_WidgetQR::m_draw(bool flagAll)
+{
+    m_clear();
+
+    if ((m_modules != nullptr) and (m_size > 0))
+    {
+        uint16_t dz = hV_HAL_min(m_dx, m_dy) / m_size;
+        uint16_t x = m_x0 + (m_dx - m_size * dz) / 2;
+        uint16_t y = m_y0 + (m_dy - m_size * dz) / 2;
+
+        bool oldPenSolid = m_screen->getPenSolid();
+        m_screen->setPenSolid(true);
+        for (uint8_t jy = 0; jy < m_size; jy += 1)
+        {
+            for (uint8_t ix = 0; ix < m_size; ix += 1)
+            {
+                uint32_t offset = (uint32_t)jy * m_size + ix;
+                if (bitRead(m_modules[offset >> 3], 7 - (offset % 8)))
+                {
+                    m_screen->dRectangle(x + dz * ix, y + dz * jy, dz, dz, m_textColour);
+                }
+            }
+        }
+        m_screen->setPenSolid(oldPenSolid);
+    }
+
+    return getArea();
+}
+
+//
+// === Menu
+//
+hV_WidgetMenu::hV_WidgetMenu(hV_Screen_Buffer * screen) : hV_Widget(screen)
+{
+    m_options = nullptr;
+    m_number = 0;
+    m_font = 0;
+    m_selected = 0xff;
+    m_drawnSelected = 0xff;
+}
+
+void hV_WidgetMenu::setFont(uint8_t font)
+{
+    if (font != m_font)
+    {
+        m_font = font;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_WidgetMenu::setOptions(const char * const * options, uint8_t number)
+{
+    if ((options != m_options) or (number != m_number))
+    {
+        m_options = options;
+        m_number = number;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_WidgetMenu::setSelected(uint8_t index)
+{
+    if (index >= m_number)
+    {
+        index = 0xff;
+    }
+
+    if (index != m_selected)
+    {
+        m_selected = index;
+        m_flagChanged = true;
+    }
+}
+
+uint8_t hV_WidgetMenu::getSelected()
+{
+    return m_selected;
+}
+
+area_s hV_WidgetMenu::m_draw(bool flagAll)
+{
+    area_s result = { 0, 0, 0, 0 };
+
+    if (flagAll)
+    {
+        m_clear();
+        for (uint8_t index = 0; index < m_number; index += 1)
+        {
+            m_drawOption(index);
+        }
+        result = getArea();
+    }
+    else
+    {
+        // Previous and new selected options only
+        addArea(result, m_drawOption(m_drawnSelected));
+        addArea(result, m_drawOption(m_selected));
+    }
+
+    m_drawnSelected = m_selected;
+    return result;
+}
+
+area_s hV_WidgetMenu::m_drawOption(uint8_t index)
+{
+    area_s result = { 0, 0, 0, 0 };
+
+    if ((m_options == nullptr) or (index >= m_number))
+    {
+        return result;
+    }
+
+    uint16_t part = m_dx / m_number;
+    uint16_t x = m_x0 + index * part;
+    bool flagInverse = (index == m_selected);
+    uint16_t textColour = flagInverse ? m_backColour : m_textColour;
+    uint16_t backColour = flagInverse ? m_textColour : m_backColour;
+
+    bool oldPenSolid = m_screen->getPenSolid();
+    m_screen->setPenSolid(true);
+    m_screen->dRectangle(x, m_y0, part, m_dy, backColour);
+    m_screen->setPenSolid(oldPenSolid);
+
+    m_selectFont(m_font);
+    uint16_t width = m_screen->stringSizeX(m_options[index]);
+    uint16_t height = m_screen->characterSizeY();
+    uint16_t xText = x + ((width < part) ? (part - width) / 2 : 0);
+    uint16_t yText = m_y0 + ((height < m_dy) ? (m_dy - height) / 2 : 0);
+    m_screen->gText(xText, yText, m_options[index], textColour, backColour);
+    m_restoreFont();
+
+    result = { x, m_y0, part, m_dy };
+    return result;
+}
+
+//
+// === Chart
+//
+hV_WidgetChart::hV_WidgetChart(hV_Screen_Buffer * screen) : hV_Widget(screen)
+{
+    m_series = nullptr;
+    m_level = 0;
+    m_minimum = 0;
+    m_maximum = 100;
+    m_mode = CHART_MINMAX;
+    m_drawnTotal = 0;
+    m_drawnLeft = 0;
+    m_drawnLast = 0;
+    m_finalBucket = -1;
+    m_finalState.flagValid = false;
+}
+
+void hV_WidgetChart::setSeries(hV_TimeSeries * series, uint8_t level)
+{
+    if ((series != m_series) or (level != m_level))
+    {
+        m_series = series;
+        m_level = level;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_WidgetChart::setRange(int16_t minimum, int16_t maximum)
+{
+    if ((minimum != m_minimum) or (maximum != m_maximum))
+    {
+        m_minimum = minimum;
+        m_maximum = maximum;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_WidgetChart::setMode(uint8_t mode)
+{
+    if (mode != m_mode)
+    {
+        m_mode = mode;
+        m_flagInvalid = true;
+    }
+}
+
+void hV_WidgetChart::update()
+{
+    if ((m_series != nullptr) and (m_series->getTotal(m_level) != m_drawnTotal))
+    {
+        m_flagChanged = true;
+    }
+}
+
+uint16_t hV_WidgetChart::m_ratio()
+{
+    if (m_dx < 3)
+    {
+        return 1;
+    }
+
+    uint16_t columns = m_dx - 2;
+    return hV_HAL_max(1, (TIME_SERIES_SIZE + columns - 1) / columns);
+}
+
+uint16_t hV_WidgetChart::m_valueToY(int16_t value)
+{
+    uint16_t height = m_dy - 2;
+
+    if (m_maximum <= m_minimum)
+    {
+        return m_y0 + 1 + (height - 1) / 2;
+    }
+
+    value = hV_HAL_max(m_minimum, hV_HAL_min(m_maximum, value));
+    return m_y0 + height - (int32_t)(value - m_minimum) * (height - 1) / (m_maximum - m_minimum);
+}
+
+bool hV_WidgetChart::m_compute(uint32_t bucket, chartColumn_s & state, int16_t & low, int16_t & high)
+{
+    uint16_t ratio = m_ratio();
+    uint32_t total = m_series->getTotal(m_level);
+    uint32_t first = total - m_series->getCount(m_level);
+    uint32_t start = hV_HAL_max((uint32_t)bucket * ratio, first);
+    uint32_t end = hV_HAL_min((uint32_t)bucket * ratio + ratio, total);
+
+    if (start >= end)
+    {
+        state.flagValid = false;
+        return false;
+    }
+
+    if (m_mode == CHART_LTTB)
+    {
+        uint32_t chosen = start; // First entry kept
+
+        if (end == total)
+        {
+            chosen = total - 1; // Last entry kept
+        }
+        else if (state.flagValid)
+        {
+            // Average of the next column, as sums
+            uint32_t nextEnd = hV_HAL_min(end + ratio, total);
+            int64_t sumX = 0;
+            int64_t sumY = 0;
+            for (uint32_t index = end; index < nextEnd; index += 1)
+            {
+                sumX += index - state.index;
+                sumY += m_series->getSample(index - first, m_level).mean - state.value;
+            }
+
+            // Largest triangle with the previous entry selected and the average of the next column
+            int64_t largest = -1;
+            for (uint32_t index = start; index < end; index += 1)
+            {
+                int64_t x = index - state.index;
+                int64_t y = m_series->getSample(index - first, m_level).mean - state.value;
+                int64_t area = x * sumY - sumX * y;
+                if (area < 0)
+                {
+                    area = -area;
+                }
+                if (area > largest)
+                {
+                    largest = area;
+                    chosen = index;
+                }
+            }
+        }
+
+        int16_t value = m_series->getSample(chosen - first, m_level).mean;
+
+        // Line from the previous entry selected
+        low = value;
+        high = value;
+        if (state.flagValid)
+        {
+            low = hV_HAL_min(low, state.value);
+            high = hV_HAL_max(high, state.value);
+        }
+
+        state = { true, value, value, value, chosen };
+    }
+    else // CHART_MINMAX
+    {
+        int16_t minimum = INT16_MAX;
+        int16_t maximum = INT16_MIN;
+        for (uint32_t index = start; index < end; index += 1)
+        {
+            timeSample_s entry = m_series->getSample(index - first, m_level);
+            minimum = hV_HAL_min(minimum, entry.minimum);
+            maximum = hV_HAL_max(maximum, entry.maximum);
+        }
+
+        // Joined with the previous column
+        low = minimum;
+        high = maximum;
+        if (state.flagValid)
+        {
+            if (state.minimum > high)
+            {
+                high = state.minimum;
+            }
+            if (state.maximum < low)
+            {
+                low = state.maximum;
+            }
+        }
+
+        state = { true, minimum, maximum, maximum, end - 1 };
+    }
+
+    return true;
+}
+
+void hV_WidgetChart::m_drawColumn(uint16_t x, bool flagDraw, int16_t low, int16_t high)
+{
+    m_screen->line(x, m_y0 + 1, x, m_y0 + m_dy - 2, m_backColour);
+
+    if (flagDraw)
+    {
+        m_screen->line(x, m_valueToY(high), x, m_valueToY(low), m_textColour);
+    }
+}
+
+area_s hV_WidgetChart::m_draw(bool flagAll)
+{
+    area_s result = { 0, 0, 0, 0 };
+
+    if ((m_dx < 3) or (m_dy < 3))
+    {
+        return result;
+    }
+
+    uint16_t columns = m_dx - 2;
+    uint32_t total = (m_series != nullptr) ? m_series->getTotal(m_level) : 0;
+
+    if (total == 0)
+    {
+        m_clear();
+        m_screen->dRectangle(m_x0, m_y0, m_dx, m_dy, m_textColour);
+        m_drawnTotal = 0;
+        m_finalBucket = -1;
+        return getArea();
+    }
+
+    // Columns as absolute numbers, last one on the right
+    uint16_t ratio = m_ratio();
+    uint32_t first = total - m_series->getCount(m_level);
+    uint32_t last = (total - 1) / ratio;
+    uint32_t left = (first + ratio - 1) / ratio; // first column with all its entries
+    if (last + 1 > (uint32_t)columns + left)
+    {
+        left = last + 1 - columns;
+    }
+    left = hV_HAL_min(left, last);
+
+    // Last column not to be drawn again
+    int32_t finalBucket = (m_mode == CHART_LTTB) ? (int32_t)(total / ratio) - 2 : (int32_t)(total / ratio) - 1;
+
+    bool flagFull = flagAll or (m_drawnTotal == 0) or (total < m_drawnTotal) or (last - m_drawnLast >= columns);
+    uint32_t shift = flagFull ? 0 : last - m_drawnLast;
+    uint16_t xInner = m_x0 + 1;
+    uint16_t yInner = m_y0 + 1;
+
+    if (shift > 0)
+    {
+        if (m_screen->scrollLeft(xInner, yInner, columns, m_dy - 2, shift, m_backColour) == RESULT_ERROR)
+        {
+            flagFull = true;
+        }
+        else
+        {
+            result = { xInner, yInner, columns, (uint16_t)(m_dy - 2) };
+        }
+    }
+
+    chartColumn_s state;
+    state.flagValid = false;
+    uint32_t from = left;
+
+    if (flagFull)
+    {
+        m_clear();
+        m_screen->dRectangle(m_x0, m_y0, m_dx, m_dy, m_textColour);
+        m_finalBucket = -1;
+        result = getArea();
+    }
+    else
+    {
+        // Columns no longer in the series
+        for (uint32_t bucket = m_drawnLeft; bucket < left; bucket += 1)
+        {
+            if (last - bucket < columns)
+            {
+                uint16_t x = xInner + columns - 1 - (last - bucket);
+                m_drawColumn(x, false);
+                addArea(result, x, yInner, 1, m_dy - 2);
+            }
+        }
+
+        // From the last column not to be drawn again
+        if (m_finalBucket >= (int32_t)left)
+        {
+            state = m_finalState;
+            from = m_finalBucket + 1;
+        }
+    }
+
+    for (uint32_t bucket = from; bucket <= last; bucket += 1)
+    {
+        int16_t low, high;
+        uint16_t x = xInner + columns - 1 - (last - bucket);
+        bool flagDraw = m_compute(bucket, state, low, high);
+
+        m_drawColumn(x, flagDraw, low, high);
+        addArea(result, x, yInner, 1, m_dy - 2);
+
+        if ((int32_t)bucket == finalBucket)
+        {
+            m_finalBucket = finalBucket;
+            m_finalState = state;
+        }
+    }
+
+    m_drawnTotal = total;
+    m_drawnLeft = left;
+    m_drawnLast = last;
+    return result;
+}
+
@@ -0,0 +1,618 @@
+///
+/// @file hV_Widget.h
+/// @brief Retained widgets with invalidation
+///
+/// @details Project Pervasive Displays Library Suite
+/// @n Based on highView technology
+///
+/// @n Static tree of widgets drawn on a screen
+/// * Panel, label, value, bar, icon, QR-code and menu
+/// * Each widget tracks its own invalidation
+/// * render() draws only the widgets invalidated and returns the area modified
+/// * No heap, widgets declared by the application
+///
+/// @author Rei Vilo
+/// @date 21 Jun 2025
+/// @version 830
+///
+/// @copyright (c) Rei Vilo, 2010-2025
+/// @copyright All rights reserved
+/// @copyright For exclusive use with Pervasive Displays screens
+///
+/// * Basic edition: for hobbyists and for basic usage
+/// @n Creative Commons Attribution-ShareAlike 4.0 International (CC BY-SA 4.0)
+/// @see https://creativecommons.org/licenses/by-sa/4.0/
+///
+/// @n Consider the Evaluation or Commercial editions for professionals or organisations and for commercial usage
+///
+/// * Evaluation edition: for professionals or organisations, evaluation only, no commercial usage
+/// @n All rights reserved
+///
+/// * Commercial edition: for professionals or organisations, commercial usage
+/// @n All rights reserved
+///
+/// * Viewer edition: for professionals or organisations
+/// @n All rights reserved
+///
+/// * Documentation
+/// @n All rights reserved
+///
+
+// SDK
+#include "hV_HAL_Peripherals.h"
+
+// Configuration
+#include "hV_Configuration.h"
+
+// Screen
+#include "hV_Screen_Buffer.h"
+
+// Text field
+#include "hV_TextField.h"
+
+// Time series
+#include "hV_TimeSeries.h"
+
+#ifndef hV_WIDGET_RELEASE
+///
+/// @brief Library release number
+///
+#define hV_WIDGET_RELEASE 830
+
+// Objects
+//
+///
+/// @brief Base class for widgets
+/// @details A widget has an area, colours, a parent and children.
+/// Setters mark the widget only when the content changes.
+/// render() draws the parts changed of the widgets,
+/// the whole widgets invalidated and all the children of a widget drawn whole.
+///
+/// @note Widgets are declared by the application, statically or not,
+/// and linked with addChild(). Nothing is allocated.
+/// @note Call invalidate() on the root after clear()
+/// @note Font is left solid and pen not solid after render()
+///
+/// @n Example
+/// @code {.cpp}
+/// hV_WidgetPanel myRoot(&myScreen);
+/// hV_WidgetLabel myTitle(&myScreen);
+/// hV_WidgetValue myTemperature(&myScreen);
+///
+/// myRoot.setArea(0, 0, myScreen.screenSizeX(), myScreen.screenSizeY());
+/// myTitle.setArea(0, 0, 120, 16);
+/// myTitle.setText("Temperature");
+/// myTemperature.setArea(0, 20, 0, 0);
+/// myTemperature.setFormat(Font_Terminal12x16, 7, 1, "oC");
+/// myRoot.addChild(&myTitle);
+/// myRoot.addChild(&myTemperature);
+///
+/// myTemperature.setValue(215);
+/// area_s area = myRoot.render(); // all widgets the first time
+/// myTemperature.setValue(216);
+/// area = myRoot.render(); // one character of myTemperature
+/// if (area.dx > 0)
+/// {
+///     myScreen.flush();
+/// }
+/// @endcode
+///
+class hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_Widget(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the area
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx width, x-axis
+    /// @param dy height, y-axis
+    ///
+    virtual void setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Set the colours
+    /// @param textColour 16-bit colour, default = black
+    /// @param backColour 16-bit colour, default = white
+    ///
+    void setColours(uint16_t textColour = myColours.black, uint16_t backColour = myColours.white);
+
+    ///
+    /// @brief Add a child
+    /// @param child widget drawn after and over this widget
+    /// @note A widget has one parent only
+    ///
+    void addChild(hV_Widget * child);
+
+    ///
+    /// @brief Force a redraw at next render()
+    ///
+    void invalidate();
+
+    ///
+    /// @brief Set the value
+    /// @param value fixed-point value
+    /// @note Default implementation does nothing, for widgets without value
+    /// @see hV_Binding
+    ///
+    virtual void setValue(int32_t value);
+
+    ///
+    /// @brief Check the widget and its children
+    /// @return true if render() would draw something
+    ///
+    bool isInvalid();
+
+    ///
+    /// @brief Area of the widget
+    /// @return area
+    ///
+    area_s getArea();
+
+    ///
+    /// @brief Draw the widgets invalidated, this one and its children
+    /// @return smallest area containing the widgets drawn, dx = 0 if none
+    /// @note Use the area to skip flush() when nothing changed
+    ///
+    area_s render();
+
+  protected:
+    /// @cond
+
+    ///
+    /// @brief Draw the widget
+    /// @param flagAll true = whole widget, false = only the parts changed
+    /// @return area modified
+    ///
+    virtual area_s m_draw(bool flagAll) = 0;
+
+    ///
+    /// @brief Render the widget and its children
+    /// @param area area to extend with the parts drawn
+    /// @param flagAll true = parent drawn, whole widget required
+    ///
+    void m_render(area_s & area, bool flagAll);
+
+    ///
+    /// @brief Clear the area of the widget with the back colour
+    ///
+    void m_clear();
+
+    ///
+    /// @brief Select the font and opaque text, keep the previous ones
+    /// @param font font number
+    ///
+    void m_selectFont(uint8_t font);
+
+    ///
+    /// @brief Restore the previous font and text opacity
+    ///
+    void m_restoreFont();
+
+    hV_Screen_Buffer * m_screen;
+    uint16_t m_x0, m_y0, m_dx, m_dy;
+    uint16_t m_textColour, m_backColour;
+    bool m_flagInvalid; // whole widget to draw
+    bool m_flagChanged; // content changed, parts to draw
+    uint8_t m_oldFont;
+    bool m_oldFontSolid;
+
+    hV_Widget * m_child; // first child
+    hV_Widget * m_next; // next sibling
+
+    /// @endcond
+};
+
+///
+/// @brief Panel widget
+/// @details Area cleared with the back colour, optional frame
+/// @note Use a panel as root of the tree
+///
+class hV_WidgetPanel : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetPanel(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the frame
+    /// @param flag true = frame with the text colour, default = false
+    ///
+    void setFrame(bool flag = false);
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    bool m_flagFrame;
+    /// @endcond
+};
+
+///
+/// @brief Label widget
+/// @details One line of text aligned in the area
+///
+class hV_WidgetLabel : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetLabel(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the font and the alignment
+    /// @param font font number, 0..fontMax()-1
+    /// @param align ALIGN_LEFT, ALIGN_CENTER or ALIGN_RIGHT, default = ALIGN_LEFT
+    ///
+    void setFont(uint8_t font, uint8_t align = ALIGN_LEFT);
+
+    ///
+    /// @brief Set the text
+    /// @param text null-terminated UTF-8 string
+    /// @note The text is not copied and should remain available
+    /// @note Same text with same content keeps the widget valid
+    ///
+    void setText(const char * text);
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    const char * m_text;
+    uint32_t m_checksum;
+    uint8_t m_font;
+    uint8_t m_align;
+    /// @endcond
+};
+
+///
+/// @brief Value widget
+/// @details Fixed-point number, only the characters changed are drawn
+/// @see hV_TextField
+///
+class hV_WidgetValue : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetValue(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the area
+    /// @param x0 top left coordinate, x-axis
+    /// @param y0 top left coordinate, y-axis
+    /// @param dx ignored, from setFormat()
+    /// @param dy ignored, from setFormat()
+    ///
+    void setArea(uint16_t x0, uint16_t y0, uint16_t dx, uint16_t dy);
+
+    ///
+    /// @brief Set the format
+    /// @param font font number, 0..fontMax()-1
+    /// @param cells number of characters, including sign and unit
+    /// @param decimals number of decimals, default = 0
+    /// @param unit null-terminated suffix, default = none
+    /// @param scale 1 = normal, 2 = large, default = 1
+    ///
+    void setFormat(uint8_t font, uint8_t cells, uint8_t decimals = 0, const char * unit = nullptr, uint8_t scale = 1);
+
+    ///
+    /// @brief Set the value
+    /// @param value fixed-point value, ie. value x10^decimals
+    ///
+    void setValue(int32_t value);
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    hV_TextField m_field;
+    int32_t m_value;
+    uint8_t m_font, m_cells, m_decimals, m_scale;
+    const char * m_unit;
+    /// @endcond
+};
+
+///
+/// @brief Bar widget
+/// @details Horizontal bar with frame, proportional to the value
+///
+class hV_WidgetBar : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetBar(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the range
+    /// @param minimum value for an empty bar
+    /// @param maximum value for a full bar
+    ///
+    void setRange(int32_t minimum, int32_t maximum);
+
+    ///
+    /// @brief Set the value
+    /// @param value within the range, otherwise capped
+    /// @note Same width in pixels keeps the widget valid
+    ///
+    void setValue(int32_t value);
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    ///
+    /// @brief Width of the bar for a value
+    ///
+    uint16_t m_width(int32_t value);
+
+    int32_t m_minimum, m_maximum, m_value;
+    uint16_t m_drawn; // width drawn, 0xffff = none
+    /// @endcond
+};
+
+///
+/// @brief Icon widget
+/// @details Monochrome bitmap centred in the area
+///
+class hV_WidgetIcon : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetIcon(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the bitmap
+    /// @param bitmap rows from top to bottom, (width + 7) / 8 bytes per row, MSB first, 1 = text colour
+    /// @param width width of the bitmap, pixels
+    /// @param height height of the bitmap, pixels
+    /// @note The bitmap is not copied and should remain available
+    ///
+    void setBitmap(const uint8_t * bitmap, uint16_t width, uint16_t height);
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    const uint8_t * m_bitmap;
+    uint16_t m_width, m_height;
+    /// @endcond
+};
+
+///
+/// @brief QR-code widget
+/// @details Modules scaled to fit the area and centred
+/// @note Same format as QRCode.modules of the QRCode library,
+/// https://github.com/ricmoo/qrcode/
+///
+class hV_WidgetQR : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetQR(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the modules
+    /// @param modules size x size bits, row after row, MSB first, 1 = dark
+    /// @param size number of modules per side
+    /// @note The modules are not copied and should remain available
+    /// @note Always invalidates the widget
+    ///
+    void setModules(const uint8_t * modules, uint8_t size);
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    const uint8_t * m_modules;
+    uint8_t m_size;
+    /// @endcond
+};
+
+///
+/// @brief Menu widget
+/// @details Options side by side in equal parts of the area, selected option inverse
+///
+class hV_WidgetMenu : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetMenu(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the font
+    /// @param font font number, 0..fontMax()-1
+    ///
+    void setFont(uint8_t font);
+
+    ///
+    /// @brief Set the options
+    /// @param options array of null-terminated UTF-8 strings
+    /// @param number number of options
+    /// @note The options are not copied and should remain available
+    ///
+    void setOptions(const char * const * options, uint8_t number);
+
+    ///
+    /// @brief Select an option
+    /// @param index option, 0..number-1, otherwise none
+    /// @note Only the previous and new options are drawn again
+    ///
+    void setSelected(uint8_t index);
+
+    ///
+    /// @brief Selected option
+    /// @return index of the option, 0xff = none
+    ///
+    uint8_t getSelected();
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    ///
+    /// @brief Draw one option
+    /// @param index option
+    /// @return area modified
+    ///
+    area_s m_drawOption(uint8_t index);
+
+    const char * const * m_options;
+    uint8_t m_number;
+    uint8_t m_font;
+    uint8_t m_selected, m_drawnSelected;
+    /// @endcond
+};
+
+///
+/// @brief Column of a chart
+/// @details Values kept from the previous column to draw the next one
+///
+struct chartColumn_s
+{
+    bool flagValid; ///< false = no previous column
+    int16_t minimum; ///< minimum of the column, CHART_MINMAX
+    int16_t maximum; ///< maximum of the column, CHART_MINMAX
+    int16_t value; ///< value selected for the column, CHART_LTTB
+    uint32_t index; ///< entry selected for the column, CHART_LTTB
+};
+
+///
+/// @brief Chart widget
+/// @details Time series drawn inside a frame, one pixel per column, last entry on the right
+/// * Fewer entries than columns: one entry per column
+/// * More entries than columns: several entries per column, see setMode()
+/// * New entries: columns already drawn scrolled left with scrollLeft(),
+/// only the new columns and the last one drawn again
+///
+/// @note Entries per column = TIME_SERIES_SIZE / (width - 2), rounded up,
+/// so the entries available fit in the frame
+/// @note Call update() after adding entries to the series
+///
+/// @n Example
+/// @code {.cpp}
+/// hV_TimeSeries myTemperatures;
+/// hV_WidgetChart myChart(&myScreen);
+///
+/// myChart.setArea(0, 40, 130, 60);
+/// myChart.setSeries(&myTemperatures);
+/// myChart.setRange(-100, 400); // -10.0 to 40.0 °C
+///
+/// myTemperatures.add(215);
+/// myChart.update();
+/// area_s area = myChart.render(); // new column only
+/// @endcode
+///
+class hV_WidgetChart : public hV_Widget
+{
+  public:
+    ///
+    /// @brief Constructor
+    /// @param screen screen to draw on
+    ///
+    hV_WidgetChart(hV_Screen_Buffer * screen);
+
+    ///
+    /// @brief Set the time series
+    /// @param series time series, not copied
+    /// @param level 0 = samples, default, up to TIME_SERIES_LEVELS - 1
+    ///
+    void setSeries(hV_TimeSeries * series, uint8_t level = 0);
+
+    ///
+    /// @brief Set the range of the vertical axis
+    /// @param minimum value at the bottom
+    /// @param maximum value at the top
+    /// @note Values out of range are drawn at the limits
+    ///
+    void setRange(int16_t minimum, int16_t maximum);
+
+    ///
+    /// @brief Set the downsampling
+    /// @param mode CHART_MINMAX = default, or CHART_LTTB
+    /// * CHART_MINMAX: vertical line from the minimum to the maximum of the entries of the column,
+    /// peaks kept
+    /// * CHART_LTTB: one entry per column selected by largest triangle three buckets, shape kept
+    ///
+    void setMode(uint8_t mode = CHART_MINMAX);
+
+    ///
+    /// @brief Check the series for new entries
+    /// @note Call after adding entries and before render()
+    ///
+    void update();
+
+  protected:
+    /// @cond
+    area_s m_draw(bool flagAll);
+
+    ///
+    /// @brief Number of entries per column
+    /// @return number of entries, 1 or more
+    ///
+    uint16_t m_ratio();
+
+    ///
+    /// @brief Compute a column
+    /// @param bucket column, as absolute number
+    /// @param[out] state previous column, updated with this column
+    /// @param[out] low lowest value to draw
+    /// @param[out] high highest value to draw
+    /// @return true if entries available, false otherwise
+    ///
+    bool m_compute(uint32_t bucket, chartColumn_s & state, int16_t & low, int16_t & high);
+
+    ///
+    /// @brief Draw a column
+    /// @param x coordinate of the column, x-axis
+    /// @param flagDraw true = clear and draw, false = clear only
+    /// @param low lowest value
+    /// @param high highest value
+    ///
+    void m_drawColumn(uint16_t x, bool flagDraw, int16_t low = 0, int16_t high = 0);
+
+    ///
+    /// @brief Convert a value into a coordinate
+    /// @param value value
+    /// @return coordinate, y-axis
+    ///
+    uint16_t m_valueToY(int16_t value);
+
+    hV_TimeSeries * m_series;
+    uint8_t m_level;
+    int16_t m_minimum, m_maximum;
+    uint8_t m_mode;
+
+    uint32_t m_drawnTotal; // entries drawn
+    uint32_t m_drawnLeft, m_drawnLast; // first and last columns drawn, as absolute numbers
+    int32_t m_finalBucket; // last column not to be drawn again, -1 = none
+    chartColumn_s m_finalState; // state after m_finalBucket
+    /// @endcond
+};
+
+#endif // hV_WIDGET_RELEASE
+